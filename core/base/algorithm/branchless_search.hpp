@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stddef.h>
+#include <algorithm>
+
+namespace pkn
+{
+
+constexpr size_t RangeNotFound = (size_t)-1;
+
+/*
+Branch free binary search over n sorted, non overlapping ranges [begins[i], ends[i]).
+Returns the index of the range containing value, RangeNotFound if none does.
+*/
+template <class T>
+inline size_t branchless_upper_search(const T *begins, const T *ends, size_t n, T value) noexcept
+{
+    if (n == 0)
+        return RangeNotFound;
+    const T *base = begins;
+    while (n > 1)
+    {
+        size_t half = n / 2;
+        base = base[half] <= value ? base + half : base;
+        n -= half;
+    }
+    size_t index = base - begins;
+    return (*base <= value && value < ends[index]) ? index : RangeNotFound;
+}
+
+/*
+out[i] = branchless_upper_search(begins, ends, n, values[i])
+The searches of eight values run interleaved, so their cache misses overlap.
+*/
+template <class T>
+inline void branchless_upper_search(const T *begins, const T *ends, size_t n, const T *values, size_t count, size_t *out) noexcept
+{
+    constexpr size_t Lanes = 8;
+    if (n == 0)
+    {
+        std::fill(out, out + count, RangeNotFound);
+        return;
+    }
+    size_t i = 0;
+    for (; i + Lanes <= count; i += Lanes)
+    {
+        // every search halves the same range length, so the lanes advance together
+        const T *base[Lanes];
+        for (size_t lane = 0; lane < Lanes; lane++)
+            base[lane] = begins;
+        for (size_t m = n; m > 1;)
+        {
+            size_t half = m / 2;
+            for (size_t lane = 0; lane < Lanes; lane++)
+                base[lane] = base[lane][half] <= values[i + lane] ? base[lane] + half : base[lane];
+            m -= half;
+        }
+        for (size_t lane = 0; lane < Lanes; lane++)
+        {
+            size_t index = base[lane] - begins;
+            T value = values[i + lane];
+            out[i + lane] = (*base[lane] <= value && value < ends[index]) ? index : RangeNotFound;
+        }
+    }
+    for (; i < count; i++)
+        out[i] = branchless_upper_search(begins, ends, n, values[i]);
+}
+
+}
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <stdint.h>
-#include <xhash>
+#include <functional>
 #include "../compile_time/random.hpp"
 
 #pragma warning(push)
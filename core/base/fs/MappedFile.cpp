@@ -0,0 +1,89 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace pkn
+{
+
+#ifdef _WIN32
+
+std::unique_ptr<MappedFile> MappedFile::open(const std::string &path)
+{
+    std::unique_ptr<MappedFile> file(new MappedFile());
+    file->_path = path;
+    auto handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+        return nullptr;
+    file->_file = handle;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || (uint64_t)size.QuadPart > SIZE_MAX)
+        return nullptr;
+    file->_size = (size_t)size.QuadPart;
+    if (file->_size == 0)
+        return file;
+    file->_mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (file->_mapping == nullptr)
+        return nullptr;
+    file->_data = (const uint8_t *)MapViewOfFile(file->_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (file->_data == nullptr)
+        return nullptr;
+    return file;
+}
+
+MappedFile::~MappedFile()
+{
+    if (_data != nullptr)
+        UnmapViewOfFile(_data);
+    if (_mapping != nullptr)
+        CloseHandle(_mapping);
+    if (_file != nullptr)
+        CloseHandle(_file);
+}
+
+#else
+
+std::unique_ptr<MappedFile> MappedFile::open(const std::string &path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return nullptr;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        close(fd);
+        return nullptr;
+    }
+    std::unique_ptr<MappedFile> file(new MappedFile());
+    file->_path = path;
+    file->_size = (size_t)st.st_size;
+    if (file->_size != 0)
+    {
+        void *data = mmap(nullptr, file->_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            return nullptr;
+        }
+        file->_data = (const uint8_t *)data;
+    }
+    // the mapping stays valid after the descriptor is closed
+    close(fd);
+    return file;
+}
+
+MappedFile::~MappedFile()
+{
+    if (_data != nullptr)
+        munmap((void *)_data, _size);
+}
+
+#endif
+
+}
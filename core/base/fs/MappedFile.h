@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+
+#include "../noncopyable.h"
+
+namespace pkn
+{
+
+/*
+Read only view of a whole file mapped into memory, pages are brought in by the OS on first touch.
+Works the same on Windows and on POSIX systems.
+
+usage:
+@code
+if (auto file = MappedFile::open("/srv/dlls/ntdll.dll"))
+    if (auto pe = PEView::parse(file->data(), file->size()))
+        ...;
+@endcode
+*/
+class MappedFile : noncopyable
+{
+public:
+    // nullptr if the file can not be opened or mapped; an empty file maps to size() == 0
+    static std::unique_ptr<MappedFile> open(const std::string &path);
+    ~MappedFile();
+public:
+    inline const uint8_t *data() const noexcept { return _data; }
+    inline size_t size() const noexcept { return _size; }
+    inline const std::string &path() const noexcept { return _path; }
+private:
+    MappedFile() = default;
+private:
+    std::string _path;
+    const uint8_t *_data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    void *_file = nullptr;
+    void *_mapping = nullptr;
+#endif
+};
+
+}
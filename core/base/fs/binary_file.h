@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/*
+Helpers shared by the writers of the on disk caches and databases(.pemc, .pdbc, .pedb).
+
+usage:
+@code
+StringPool strings;
+header.name = strings.add(name);
+header.strings = align8(header.entries + count * sizeof(Entry));
+
+bool ok = write_file_replacing(path, [&](FILE *file)
+                               {
+                                   return fwrite(&header, sizeof(header), 1, file) == 1;
+                               });
+@endcode
+*/
+
+namespace pkn
+{
+
+template <class T>
+constexpr T align8(T value) noexcept
+{
+    return (value + 7) & ~(T)7;
+}
+
+/*
+Null terminated strings packed into one buffer, equal strings are stored once.
+Offset 0 is the empty string.
+The pool does not copy its keys: added strings must outlive it.
+*/
+class StringPool
+{
+public:
+    StringPool() { _data.push_back('\0'); }
+public:
+    uint32_t add(std::string_view s)
+    {
+        if (s.empty())
+            return 0;
+        auto it = _offsets.find(s);
+        if (it != _offsets.end())
+            return it->second;
+        uint32_t offset = (uint32_t)_data.size();
+        _data.append(s.data(), s.size());
+        _data.push_back('\0');
+        _offsets.emplace(s, offset);
+        return offset;
+    }
+    inline std::string_view at(uint32_t offset) const noexcept { return std::string_view(_data.data() + offset); }
+    inline const std::string &data() const noexcept { return _data; }
+private:
+    std::string _data;
+    std::unordered_map<std::string_view, uint32_t> _offsets;
+};
+
+// nullptr on failure
+inline FILE *open_file(const std::string &path, const char *mode) noexcept
+{
+    FILE *file = nullptr;
+#ifdef _MSC_VER
+    if (fopen_s(&file, path.c_str(), mode) != 0)
+        file = nullptr;
+#else
+    file = fopen(path.c_str(), mode);
+#endif
+    return file;
+}
+
+// replaces an existing destination
+inline bool replace_file(const std::string &from, const std::string &to) noexcept
+{
+    std::error_code ec;
+    std::filesystem::rename(from, to, ec);
+    return !ec;
+}
+
+/*
+Writes path through path + ".tmp": the destination is replaced only once write(FILE *) returned true
+and the file was flushed, a failed write never leaves a truncated file behind.
+*/
+template <class Writer>
+bool write_file_replacing(const std::string &path, Writer &&write)
+{
+    auto temp = path + ".tmp";
+    FILE *file = open_file(temp, "wb");
+    if (file == nullptr)
+        return false;
+    bool success = write(file);
+    success = fclose(file) == 0 && success;
+    if (success && replace_file(temp, path))
+        return true;
+    remove(temp.c_str());
+    return false;
+}
+
+}
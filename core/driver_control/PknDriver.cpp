@@ -4,6 +4,7 @@
 
 #include <string>
 #include <string_view>
+#include <vector>
 #include <xutility>
 
 #include "PknDriver.h"
@@ -81,6 +82,44 @@ bool PknDriver::read_process_memory(const pid_t &pid, const erptr_t &remote_addr
     return false;
 }
 
+bool PknDriver::read_process_memories(pid_t pid, size_t count, ReadProcessMemoriesData *pdatas) const noexcept
+{
+    // bounds the time one request spends in the driver
+    constexpr size_t max_count_per_ioctl = 1024;
+    bool all_success = true;
+    std::vector<uint8_t> buffer;
+    for (size_t first = 0; first < count; first += max_count_per_ioctl)
+    {
+        size_t n = (std::min)(count - first, max_count_per_ioctl);
+        buffer.resize(sizeof(ReadProcessMemoriesInputHead) + n * sizeof(ReadProcessMemoriesInputData));
+        auto head = (ReadProcessMemoriesInputHead *)buffer.data();
+        auto datas = (ReadProcessMemoriesInputData *)(buffer.data() + sizeof(ReadProcessMemoriesInputHead));
+        head->xor_val = xor_key;
+        head->processid = pid;
+        head->count = n;
+        for (size_t i = 0; i < n; i++)
+        {
+            auto &data = pdatas[first + i];
+            datas[i] = ReadProcessMemoriesInputData{ data.address, data.size, (uint64_t)data.buffer, 0 };
+        }
+        xor_memory(buffer.data() + 8, buffer.size() - 8, xor_key);
+
+        uint32_t size = (uint32_t)buffer.size();
+        bool succeeded = ioctl(IOCTL_PLAYERKNOWNS_READ_PROCESS_MEMORIES, buffer.data(), size, buffer.data(), &size);
+        if (succeeded)
+            xor_memory(datas, n * sizeof(ReadProcessMemoriesInputData), xor_key);
+        for (size_t i = 0; i < n; i++)
+        {
+            auto &data = pdatas[first + i];
+            data.success = succeeded && datas[i].succeeded != 0;
+            if (data.success)
+                xor_memory(data.buffer, data.size, xor_key);
+            all_success = all_success && data.success;
+        }
+    }
+    return all_success;
+}
+
 bool PknDriver::write_process_memory(pid_t pid, erptr_t remote_address, size_t size, const void *data) const noexcept
 {
 	WriteProcessMemoryInput inp;
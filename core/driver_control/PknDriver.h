@@ -13,6 +13,14 @@
 
 namespace pkn
 {
+struct ReadProcessMemoriesData
+{
+    erptr_t address;
+    size_t size;
+    void *buffer;
+    bool success; // filled by read_process_memories
+};
+
 class PknDriver : public DriverBase
 {
 public:
@@ -33,7 +41,8 @@ public:
     bool free_nonpaged_memory(erptr_t ptr) const noexcept;
 
     // process memory
-    //void read_process_memories(pid_t pid, size_t count, const ReadProcessMemoriesData *pdatas) const;
+    // reads every range in one round trip and fills their success, true only if all of them succeeded
+    bool read_process_memories(pid_t pid, size_t count, ReadProcessMemoriesData *pdatas) const noexcept;
     bool read_process_memory(const pid_t &pid, const erptr_t &remote_address, size_t size, void *buffer) const noexcept;
     bool write_process_memory(pid_t pid, erptr_t remote_address, size_t size, const void *data) const noexcept;
     bool acquire_lock(const pid_t &pid, const erptr_t &remote_lock_address) const noexcept;
@@ -0,0 +1,414 @@
+#include "RemoteMirror.h"
+
+#include <algorithm>
+#include <string.h>
+
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/userfaultfd.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+#elif defined(_WIN32)
+#include <Windows.h>
+#include <mutex>
+#include <vector>
+#endif
+
+#include "../marcos/debug_print.h"
+
+namespace pkn
+{
+
+#ifdef _WIN32
+// vectored exception handlers are process wide, every mirror is looked up by the faulting address
+struct RemoteMirrorRegistry
+{
+    std::mutex lock;
+    std::vector<RemoteMirror *> mirrors;
+    PVOID handler = nullptr;
+public:
+    static RemoteMirrorRegistry &get()
+    {
+        static RemoteMirrorRegistry registry;
+        return registry;
+    }
+    bool add(RemoteMirror *mirror)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (handler == nullptr)
+            handler = AddVectoredExceptionHandler(1, &RemoteMirrorRegistry::on_exception);
+        if (handler == nullptr)
+            return false;
+        mirrors.push_back(mirror);
+        return true;
+    }
+    void remove(RemoteMirror *mirror)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        mirrors.erase(std::remove(mirrors.begin(), mirrors.end(), mirror), mirrors.end());
+    }
+    static LONG CALLBACK on_exception(PEXCEPTION_POINTERS info)
+    {
+        auto record = info->ExceptionRecord;
+        if (record->ExceptionCode != EXCEPTION_ACCESS_VIOLATION || record->NumberParameters < 2)
+            return EXCEPTION_CONTINUE_SEARCH;
+        auto address = (uint8_t *)record->ExceptionInformation[1];
+        // the registry lock only covers the lookup, the remote read runs without it so faults on other mirrors
+        // are not queued behind this one; the pin keeps the mirror mapped until the fault is served
+        RemoteMirror *target = nullptr;
+        {
+            auto &registry = get();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            for (auto mirror : registry.mirrors)
+            {
+                if (address >= mirror->_local && address < mirror->_local + mirror->_mapped_size)
+                {
+                    target = mirror;
+                    target->_pin.lock_shared();
+                    break;
+                }
+            }
+        }
+        if (target == nullptr)
+            return EXCEPTION_CONTINUE_SEARCH;
+        bool handled = target->handle_fault(address);
+        target->_pin.unlock_shared();
+        return handled ? EXCEPTION_CONTINUE_EXECUTION : EXCEPTION_CONTINUE_SEARCH;
+    }
+};
+#endif
+
+std::unique_ptr<RemoteMirror> RemoteMirror::create(const IProcessReader &reader, rptr_t remote_base, size_t size, size_t prefetch_pages)
+{
+    if (size == 0)
+        return nullptr;
+    std::unique_ptr<RemoteMirror> mirror(new RemoteMirror(reader, remote_base, size, prefetch_pages));
+    if (!mirror->map())
+        return nullptr;
+    return mirror;
+}
+
+RemoteMirror::RemoteMirror(const IProcessReader &reader, rptr_t remote_base, size_t size, size_t prefetch_pages)
+    : _reader(reader),
+    _remote_base(remote_base),
+    _size(size),
+    _mapped_size((size + page_size() - 1) / page_size() * page_size()),
+    _prefetch_pages(prefetch_pages),
+    _staging(new uint8_t[(prefetch_pages + 1) * page_size()])
+{}
+
+RemoteMirror::~RemoteMirror()
+{
+    unmap();
+}
+
+size_t RemoteMirror::fault_range(size_t offset) const noexcept
+{
+    return std::min((_prefetch_pages + 1) * page_size(), _mapped_size - offset);
+}
+
+void RemoteMirror::fetch(size_t offset, uint8_t *buffer, size_t size)
+{
+    if (_reader.read_unsafe(_remote_base + offset, size, buffer))
+        return;
+    // some page of the range is unreadable, find out which; the retries follow the remote pages,
+    // the local ones straddle two of them when remote_base is not page aligned
+    auto page = page_size();
+    for (size_t done = 0; done < size;)
+    {
+        rptr_t remote = _remote_base + offset + done;
+        size_t length = std::min(size - done, page - (size_t)(remote & (page - 1)));
+        if (!_reader.read_unsafe(remote, length, buffer + done))
+        {
+            memset(buffer + done, 0, length);
+            _failed_pages.fetch_add(1, std::memory_order_relaxed);
+        }
+        done += length;
+    }
+}
+
+#ifdef __linux__
+
+size_t RemoteMirror::page_size() noexcept
+{
+    static const size_t size = (size_t)sysconf(_SC_PAGESIZE);
+    return size;
+}
+
+bool RemoteMirror::map()
+{
+    auto local = mmap(nullptr, _mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (local == MAP_FAILED)
+    {
+        DebugPrint("RemoteMirror: mmap failed, errno %d\n", errno);
+        return false;
+    }
+    _local = (uint8_t *)local;
+
+    int flags = O_CLOEXEC | O_NONBLOCK;
+#ifdef UFFD_USER_MODE_ONLY
+    // only user mode faults are needed, which unprivileged processes are allowed to handle
+    _uffd = (int)syscall(SYS_userfaultfd, flags | UFFD_USER_MODE_ONLY);
+    if (_uffd < 0)
+#endif
+        _uffd = (int)syscall(SYS_userfaultfd, flags);
+    if (_uffd < 0)
+    {
+        DebugPrint("RemoteMirror: userfaultfd failed, errno %d\n", errno);
+        unmap();
+        return false;
+    }
+
+    uffdio_api api = {};
+    api.api = UFFD_API;
+    uffdio_register registration = {};
+    registration.range.start = (uint64_t)_local;
+    registration.range.len = _mapped_size;
+    registration.mode = UFFDIO_REGISTER_MODE_MISSING;
+    if (ioctl(_uffd, UFFDIO_API, &api) != 0 || ioctl(_uffd, UFFDIO_REGISTER, &registration) != 0)
+    {
+        DebugPrint("RemoteMirror: userfaultfd registration failed, errno %d\n", errno);
+        unmap();
+        return false;
+    }
+
+    _stop_event = eventfd(0, EFD_CLOEXEC);
+    if (_stop_event < 0)
+    {
+        unmap();
+        return false;
+    }
+    _handler = std::thread(&RemoteMirror::serve, this);
+    return true;
+}
+
+void RemoteMirror::unmap()
+{
+    if (_handler.joinable())
+    {
+        uint64_t one = 1;
+        (void)!write(_stop_event, &one, sizeof(one));
+        _handler.join();
+    }
+    if (_stop_event >= 0)
+        close(_stop_event);
+    if (_uffd >= 0)
+        close(_uffd);
+    if (_local != nullptr)
+        munmap(_local, _mapped_size);
+    _stop_event = _uffd = -1;
+    _local = nullptr;
+}
+
+void RemoteMirror::serve()
+{
+    auto page = page_size();
+    std::vector<unsigned char> resident((_prefetch_pages + 1));
+    pollfd fds[2] = { { _uffd, POLLIN, 0 }, { _stop_event, POLLIN, 0 } };
+    while (true)
+    {
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return;
+        }
+        if (fds[1].revents != 0)
+            return;
+
+        uffd_msg message;
+        if (read(_uffd, &message, sizeof(message)) != sizeof(message))
+            continue;
+        if (message.event != UFFD_EVENT_PAGEFAULT)
+            continue;
+
+        size_t offset = ((size_t)message.arg.pagefault.address - (size_t)_local) & ~(page - 1);
+        size_t length = fault_range(offset);
+        // stop prefetching at the first page that is already mirrored
+        if (length > page && mincore(_local + offset + page, length - page, resident.data()) == 0)
+        {
+            for (size_t i = 0; i + 1 < length / page; i++)
+            {
+                if (resident[i] & 1)
+                {
+                    length = (i + 1) * page;
+                    break;
+                }
+            }
+        }
+        fetch(offset, _staging.get(), length);
+
+        uffdio_copy copy = {};
+        copy.dst = (uint64_t)(_local + offset);
+        copy.src = (uint64_t)_staging.get();
+        copy.len = length;
+        if (ioctl(_uffd, UFFDIO_COPY, &copy) != 0 && errno == EEXIST && length > page)
+        {
+            // raced with another population of the range, fill whatever is still missing page by page
+            for (size_t done = 0; done < length; done += page)
+            {
+                copy.dst = (uint64_t)(_local + offset + done);
+                copy.src = (uint64_t)(_staging.get() + done);
+                copy.len = page;
+                ioctl(_uffd, UFFDIO_COPY, &copy);
+            }
+        }
+        _faults.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void RemoteMirror::invalidate()
+{
+    madvise(_local, _mapped_size, MADV_DONTNEED);
+}
+
+void RemoteMirror::invalidate(rptr_t address, size_t size)
+{
+    if (size == 0 || address >= _remote_base + _mapped_size || address + size <= _remote_base)
+        return;
+    auto page = page_size();
+    size_t begin = (size_t)(std::max(address, _remote_base) - _remote_base) & ~(page - 1);
+    size_t end = std::min((size_t)(address + size - _remote_base), _mapped_size);
+    end = (end + page - 1) & ~(page - 1);
+    madvise(_local + begin, end - begin, MADV_DONTNEED);
+}
+
+#elif defined(_WIN32)
+
+size_t RemoteMirror::page_size() noexcept
+{
+    static const size_t size = []()
+    {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return (size_t)info.dwPageSize;
+    }();
+    return size;
+}
+
+bool RemoteMirror::map()
+{
+    // the section is mapped twice: pages are filled through _fill and only then made accessible in _local,
+    // no thread ever sees a page of _local before its content is there
+    auto section = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                      (DWORD)((uint64_t)_mapped_size >> 32), (DWORD)_mapped_size, nullptr);
+    if (section == nullptr)
+    {
+        DebugPrint("RemoteMirror: CreateFileMapping failed, error %u\n", GetLastError());
+        return false;
+    }
+    _local = (uint8_t *)MapViewOfFile(section, FILE_MAP_WRITE, 0, 0, _mapped_size);
+    _fill = (uint8_t *)MapViewOfFile(section, FILE_MAP_WRITE, 0, 0, _mapped_size);
+    CloseHandle(section); // the views keep it alive
+    DWORD old_protect;
+    if (_local == nullptr || _fill == nullptr || !VirtualProtect(_local, _mapped_size, PAGE_NOACCESS, &old_protect))
+    {
+        DebugPrint("RemoteMirror: MapViewOfFile failed, error %u\n", GetLastError());
+        unmap();
+        return false;
+    }
+    if (!RemoteMirrorRegistry::get().add(this))
+    {
+        unmap();
+        return false;
+    }
+    return true;
+}
+
+void RemoteMirror::unmap()
+{
+    if (_local != nullptr)
+    {
+        RemoteMirrorRegistry::get().remove(this);
+        // no new fault can find this mirror anymore, wait for the ones being served
+        std::unique_lock<std::shared_mutex> pin(_pin);
+        UnmapViewOfFile(_local);
+    }
+    if (_fill != nullptr)
+        UnmapViewOfFile(_fill);
+    _local = nullptr;
+    _fill = nullptr;
+}
+
+// faults of every thread on this mirror are served one at a time
+bool RemoteMirror::handle_fault(uint8_t *address)
+{
+    std::lock_guard<std::mutex> guard(_fault_lock);
+    auto page = page_size();
+    size_t offset = (size_t)(address - _local) & ~(page - 1);
+    MEMORY_BASIC_INFORMATION info;
+    if (VirtualQuery(_local + offset, &info, sizeof(info)) == 0)
+        return false;
+    // filled by another thread while this one waited for the lock
+    if (info.Protect != PAGE_NOACCESS)
+        return true;
+    // prefetch stops at the first page that is already mirrored
+    size_t length = std::min(fault_range(offset), (size_t)info.RegionSize);
+    fetch(offset, _fill + offset, length);
+    DWORD old_protect;
+    if (!VirtualProtect(_local + offset, length, PAGE_READWRITE, &old_protect))
+        return false;
+    _faults.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// with _fault_lock held
+void RemoteMirror::drop(size_t offset, size_t size)
+{
+    DWORD old_protect;
+    VirtualProtect(_local + offset, size, PAGE_NOACCESS, &old_protect);
+    // the content is fetched again on the next touch, let the system discard it instead of paging it out
+    VirtualAlloc(_fill + offset, size, MEM_RESET, PAGE_READWRITE);
+}
+
+void RemoteMirror::invalidate()
+{
+    std::lock_guard<std::mutex> guard(_fault_lock);
+    drop(0, _mapped_size);
+}
+
+void RemoteMirror::invalidate(rptr_t address, size_t size)
+{
+    if (size == 0 || address >= _remote_base + _mapped_size || address + size <= _remote_base)
+        return;
+    auto page = page_size();
+    size_t begin = (size_t)(std::max(address, _remote_base) - _remote_base) & ~(page - 1);
+    size_t end = std::min((size_t)(address + size - _remote_base), _mapped_size);
+    end = (end + page - 1) & ~(page - 1);
+    std::lock_guard<std::mutex> guard(_fault_lock);
+    drop(begin, end - begin);
+}
+
+#else
+
+size_t RemoteMirror::page_size() noexcept
+{
+    return 0x1000;
+}
+
+bool RemoteMirror::map()
+{
+    return false;
+}
+
+void RemoteMirror::unmap()
+{
+}
+
+void RemoteMirror::invalidate()
+{
+}
+
+void RemoteMirror::invalidate(rptr_t, size_t)
+{
+}
+
+#endif
+
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <thread>
+#ifdef _WIN32
+#include <mutex>
+#include <shared_mutex>
+#endif
+
+#include "../base/noncopyable.h"
+#include "../base/types.h"
+#include "../remote_process/IProcess.h"
+
+namespace pkn
+{
+
+/*
+A local, lazily populated mirror of a remote region.
+The region is mapped into our address space without any content; the first touch of a page faults,
+and the fault handler fetches that page (plus prefetch_pages following ones) through the IProcessReader.
+Pages that can not be read are mirrored as zeros and counted in failed_pages().
+invalidate() drops mirrored pages, they are fetched again on their next touch.
+
+Code working on plain pointers (PE parsers, string scanners, disassemblers) can run on data() directly.
+The mirror is meant to be read, writes only change the local copy until the page is invalidated.
+
+On Linux the faults are served by a userfaultfd handler thread, on Windows by a vectored exception handler
+over a pagefile backed section, filled through a second view before the page is made accessible.
+create() returns nullptr if the platform refuses (e.g. userfaultfd is disabled for unprivileged users).
+
+usage:
+@code
+auto mirror = RemoteMirror::create(reader, module_base, module_size, 4);
+if (mirror)
+    parse_pe(mirror->data(), mirror->size());
+@endcode
+*/
+class RemoteMirror : noncopyable
+{
+public:
+    static std::unique_ptr<RemoteMirror> create(const IProcessReader &reader, rptr_t remote_base, size_t size, size_t prefetch_pages = 0);
+    ~RemoteMirror();
+public:
+    inline const uint8_t *data() const noexcept { return _local; }
+    inline size_t size() const noexcept { return _size; }
+    inline rptr_t remote_base() const noexcept { return _remote_base; }
+    // local address of a remote one, nullptr outside the mirrored region
+    inline const uint8_t *local(rptr_t remote) const noexcept
+    {
+        if (remote < _remote_base || remote - _remote_base >= _size)
+            return nullptr;
+        return _local + (remote - _remote_base);
+    }
+    inline rptr_t remote(const void *local) const noexcept { return _remote_base + (rptr_t)((const uint8_t *)local - _local); }
+
+    // drop every mirrored page
+    void invalidate();
+    // drop the mirrored pages touching [address, address + size)
+    void invalidate(rptr_t address, size_t size);
+public:
+    inline uint64_t faults() const noexcept { return _faults.load(std::memory_order_relaxed); }
+    inline uint64_t failed_pages() const noexcept { return _failed_pages.load(std::memory_order_relaxed); }
+    static size_t page_size() noexcept;
+private:
+    RemoteMirror(const IProcessReader &reader, rptr_t remote_base, size_t size, size_t prefetch_pages);
+    bool map();
+    void unmap();
+    // fills buffer with size bytes of the region starting at offset, unreadable pages are zeroed
+    void fetch(size_t offset, uint8_t *buffer, size_t size);
+    // bytes to populate for a fault on the page at offset: the page and the pages prefetched with it
+    size_t fault_range(size_t offset) const noexcept;
+#ifdef __linux__
+    void serve();
+#endif
+#ifdef _WIN32
+    friend struct RemoteMirrorRegistry;
+    bool handle_fault(uint8_t *address);
+    // makes [offset, offset + size) of _local fault again
+    void drop(size_t offset, size_t size);
+#endif
+private:
+    const IProcessReader &_reader;
+    rptr_t _remote_base;
+    size_t _size;
+    size_t _mapped_size; // _size rounded up to pages
+    size_t _prefetch_pages;
+    uint8_t *_local = nullptr;
+    std::atomic<uint64_t> _faults{ 0 };
+    std::atomic<uint64_t> _failed_pages{ 0 };
+    std::unique_ptr<uint8_t[]> _staging; // one fault range
+#ifdef __linux__
+    int _uffd = -1;
+    int _stop_event = -1;
+    std::thread _handler;
+#endif
+#ifdef _WIN32
+    uint8_t *_fill = nullptr; // second, always writable view of the section behind _local
+    std::mutex _fault_lock;   // serializes the fills and drops of this mirror
+    std::shared_mutex _pin;   // held shared by the faults being served, unmap() waits for them
+#endif
+};
+
+}
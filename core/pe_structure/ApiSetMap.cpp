@@ -0,0 +1,189 @@
+#include "ApiSetMap.h"
+#include "../remote_process/IProcess.h"
+
+#include <string.h>
+#include <algorithm>
+
+namespace pkn
+{
+
+namespace
+{
+
+// API_SET_NAMESPACE, API_SET_NAMESPACE_ENTRY and API_SET_VALUE_ENTRY of schema version 6, offsets from the namespace
+struct NamespaceHeader
+{
+    uint32_t version;
+    uint32_t size;
+    uint32_t flags;
+    uint32_t count;
+    uint32_t entry_offset;
+    uint32_t hash_offset;
+    uint32_t hash_factor;
+};
+
+struct NamespaceEntry
+{
+    uint32_t flags;
+    uint32_t name_offset;
+    uint32_t name_length;   // bytes
+    uint32_t hashed_length; // bytes
+    uint32_t value_offset;
+    uint32_t value_count;
+};
+
+struct ValueEntry
+{
+    uint32_t flags;
+    uint32_t name_offset;   // importer
+    uint32_t name_length;
+    uint32_t value_offset;  // host
+    uint32_t value_length;
+};
+
+constexpr size_t MaxSchemaSize = 0x1000000;
+
+inline char lower(char c) noexcept
+{
+    return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+// names are utf-16 and always ascii, false if out of the buffer
+bool narrow(const uint8_t *data, size_t size, uint32_t offset, uint32_t length, std::string &out)
+{
+    if (offset > size || length > size - offset || length % 2 != 0)
+        return false;
+    out.resize(length / 2);
+    for (size_t i = 0; i < out.size(); i++)
+    {
+        uint16_t c;
+        memcpy(&c, data + offset + i * 2, sizeof(c));
+        out[i] = c < 0x80 ? lower((char)c) : '?';
+    }
+    return true;
+}
+
+}
+
+std::string ApiSetMap::module_name(std::string_view name)
+{
+    auto slash = name.find_last_of("\\/");
+    if (slash != std::string_view::npos)
+        name.remove_prefix(slash + 1);
+    std::string result(name);
+    for (auto &c : result)
+        c = lower(c);
+    return result;
+}
+
+std::string ApiSetMap::key(std::string_view api_set)
+{
+    auto name = module_name(api_set);
+    if (name.size() > 4 && name.compare(name.size() - 4, 4, ".dll") == 0)
+        name.resize(name.size() - 4);
+    auto hyphen = name.rfind('-');
+    if (hyphen != std::string::npos)
+        name.resize(hyphen);
+    return name;
+}
+
+bool ApiSetMap::is_api_set(std::string_view dll) noexcept
+{
+    if (dll.size() < 4)
+        return false;
+    char prefix[4] = { lower(dll[0]), lower(dll[1]), lower(dll[2]), lower(dll[3]) };
+    return memcmp(prefix, "api-", 4) == 0 || memcmp(prefix, "ext-", 4) == 0;
+}
+
+void ApiSetMap::add(std::string_view api_set, std::string_view host)
+{
+    _entries[key(api_set)].host = module_name(host);
+}
+
+std::string_view ApiSetMap::resolve(std::string_view api_set, std::string_view importer) const
+{
+    auto it = _entries.find(key(api_set));
+    if (it == _entries.end())
+        return {};
+    auto &entry = it->second;
+    if (!importer.empty() && !entry.redirections.empty())
+    {
+        auto name = module_name(importer);
+        for (auto &redirection : entry.redirections)
+            if (redirection.first == name)
+                return redirection.second;
+    }
+    return entry.host;
+}
+
+std::optional<ApiSetMap> ApiSetMap::parse(const void *data, size_t size)
+{
+    auto bytes = (const uint8_t *)data;
+    NamespaceHeader header;
+    if (data == nullptr || size < sizeof(header))
+        return std::nullopt;
+    memcpy(&header, bytes, sizeof(header));
+    if (header.version != SchemaVersion)
+        return std::nullopt;
+    size = std::min<size_t>(size, header.size);
+    if (header.entry_offset > size || header.count > (size - header.entry_offset) / sizeof(NamespaceEntry))
+        return std::nullopt;
+
+    ApiSetMap map;
+    std::string name, importer, host;
+    for (uint32_t i = 0; i < header.count; i++)
+    {
+        NamespaceEntry entry;
+        memcpy(&entry, bytes + header.entry_offset + i * sizeof(entry), sizeof(entry));
+        if (!narrow(bytes, size, entry.name_offset, entry.name_length, name))
+            return std::nullopt;
+        if (entry.value_offset > size || entry.value_count > (size - entry.value_offset) / sizeof(ValueEntry))
+            return std::nullopt;
+        auto &target = map._entries[key(name)];
+        for (uint32_t k = 0; k < entry.value_count; k++)
+        {
+            ValueEntry value;
+            memcpy(&value, bytes + entry.value_offset + k * sizeof(value), sizeof(value));
+            if (!narrow(bytes, size, value.name_offset, value.name_length, importer)
+                || !narrow(bytes, size, value.value_offset, value.value_length, host))
+                return std::nullopt;
+            // the value without an importer is the default host
+            if (importer.empty())
+                target.host = host;
+            else
+                target.redirections.emplace_back(importer, host);
+        }
+    }
+    return map;
+}
+
+std::optional<ApiSetMap> ApiSetMap::from_image(const PEView &apisetschema)
+{
+    for (size_t i = 0; i < apisetschema.section_count(); i++)
+    {
+        auto section = apisetschema.section(i);
+        if (memcmp(section.Name, ".apiset", 8) != 0)
+            continue;
+        size_t offset, available;
+        if (!apisetschema.locate(section.VirtualAddress, offset, available))
+            return std::nullopt;
+        if (section.VirtualSize != 0)
+            available = std::min<size_t>(available, section.VirtualSize);
+        return parse(apisetschema.data() + offset, available);
+    }
+    return std::nullopt;
+}
+
+std::optional<ApiSetMap> ApiSetMap::read(const IProcessReader &reader, uint64_t address)
+{
+    NamespaceHeader header;
+    if (!reader.read_unsafe(address, sizeof(header), &header) || header.version != SchemaVersion
+        || header.size < sizeof(header) || header.size > MaxSchemaSize)
+        return std::nullopt;
+    std::vector<uint8_t> schema(header.size);
+    if (!reader.read_unsafe(address, schema.size(), schema.data()))
+        return std::nullopt;
+    return parse(schema.data(), schema.size());
+}
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "PEView.h"
+
+namespace pkn
+{
+
+class IProcessReader;
+
+/*
+Api set contracts("api-ms-win-core-file-l1-2-0.dll") to the dll hosting them, from the schema
+the loader uses: the namespace PEB::ApiSetMap points to, or the .apiset section of apisetschema.dll.
+Only the version 6 schema(Windows 10 and later) is understood.
+Names are matched as the loader does: case insensitively, ".dll" and the last "-N" version ignored.
+The schema is parsed once, resolutions are a hash lookup.
+
+usage:
+@code
+auto api_sets = ApiSetMap::read(process, peb.ApiSetMap);
+auto host = api_sets->resolve("api-ms-win-core-file-l1-2-0.dll");                // "kernelbase.dll"
+auto from_kernel32 = api_sets->resolve("api-ms-win-core-file-l1-2-0.dll", "kernel32.dll");
+@endcode
+*/
+class ApiSetMap
+{
+public:
+    constexpr static uint32_t SchemaVersion = 6;
+public:
+    static std::optional<ApiSetMap> parse(const void *data, size_t size);
+    static std::optional<ApiSetMap> from_image(const PEView &apisetschema);
+    // address of the namespace in the process, PEB::ApiSetMap
+    static std::optional<ApiSetMap> read(const IProcessReader &reader, uint64_t address);
+public:
+    // whether the loader would look dll up in the schema
+    static bool is_api_set(std::string_view dll) noexcept;
+    // adds or replaces the default host of an api set
+    void add(std::string_view api_set, std::string_view host);
+    // host of api_set for an image named importer, empty if api_set is unknown or has no host
+    std::string_view resolve(std::string_view api_set, std::string_view importer = {}) const;
+    inline size_t size() const noexcept { return _entries.size(); }
+private:
+    // lower case, without path, ".dll" and the last "-N"
+    static std::string key(std::string_view api_set);
+    // lower case, without path
+    static std::string module_name(std::string_view name);
+private:
+    struct Entry
+    {
+        std::string host;
+        std::vector<std::pair<std::string, std::string>> redirections; // importer, host
+    };
+    std::unordered_map<std::string, Entry> _entries;
+};
+
+}
@@ -0,0 +1,217 @@
+#include "ExportIndex.h"
+
+namespace pkn
+{
+
+void ExportIndex::clear()
+{
+    _view.reset();
+    _tables = {};
+    _name = {};
+    _slots.clear();
+}
+
+bool ExportIndex::build(const PEView &pe, bool hashed)
+{
+    clear();
+    if (pe.directory(pe_format::DirectoryExport).VirtualAddress == 0)
+    {
+        _view = pe;
+        return true;
+    }
+    auto tables = pe.export_tables();
+    if (!tables)
+        return false;
+    _view = pe;
+    _tables = *tables;
+    _name = pe.export_name();
+    if (!hashed || _tables.number_of_names == 0)
+        return true;
+
+    size_t capacity = 16;
+    while (capacity < (size_t)_tables.number_of_names * 2)
+        capacity *= 2;
+    _slots.assign(capacity, Slot{ 0, NoName });
+    for (uint32_t i = 0; i < _tables.number_of_names; i++)
+    {
+        auto name = name_at(i);
+        auto hash = compile_time::run_time::hash(name.data(), name.size());
+        size_t slot = hash & (capacity - 1);
+        while (_slots[slot].name_index != NoName)
+            slot = (slot + 1) & (capacity - 1);
+        _slots[slot] = Slot{ hash, i };
+    }
+    return true;
+}
+
+std::string_view ExportIndex::name_at(uint32_t name_index) const noexcept
+{
+    return _view->string_at_rva(_tables.name_rva(name_index));
+}
+
+std::optional<PEExport> ExportIndex::named_export(uint32_t name_index) const noexcept
+{
+    uint16_t index = _tables.name_ordinal(name_index);
+    if (index >= _tables.number_of_functions)
+        return std::nullopt;
+    auto e = _view->export_at(_tables, index);
+    e.name = name_at(name_index);
+    return e;
+}
+
+std::optional<PEExport> ExportIndex::find(std::string_view name) const noexcept
+{
+    if (!_view || _tables.number_of_names == 0)
+        return std::nullopt;
+    if (!_slots.empty())
+    {
+        auto hash = compile_time::run_time::hash(name.data(), name.size());
+        for (size_t slot = hash & (_slots.size() - 1); _slots[slot].name_index != NoName; slot = (slot + 1) & (_slots.size() - 1))
+        {
+            if (_slots[slot].hash == hash && name_at(_slots[slot].name_index) == name)
+                return named_export(_slots[slot].name_index);
+        }
+        return std::nullopt;
+    }
+
+    // the name pointer table is sorted by byte wise comparison, as string_view compares
+    uint32_t first = 0, count = _tables.number_of_names;
+    while (count > 0)
+    {
+        uint32_t half = count / 2;
+        if (name_at(first + half) < name)
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+    if (first < _tables.number_of_names && name_at(first) == name)
+        return named_export(first);
+    return std::nullopt;
+}
+
+std::optional<PEExport> ExportIndex::find(compile_time::hash_t name_hash) const noexcept
+{
+    if (_slots.empty())
+        return std::nullopt;
+    for (size_t slot = name_hash & (_slots.size() - 1); _slots[slot].name_index != NoName; slot = (slot + 1) & (_slots.size() - 1))
+    {
+        if (_slots[slot].hash == name_hash)
+            return named_export(_slots[slot].name_index);
+    }
+    return std::nullopt;
+}
+
+std::optional<PEExport> ExportIndex::find_ordinal(uint32_t ordinal) const noexcept
+{
+    if (!_view || ordinal < _tables.base || ordinal - _tables.base >= _tables.number_of_functions)
+        return std::nullopt;
+    auto e = _view->export_at(_tables, ordinal - _tables.base);
+    if (e.rva == 0)
+        return std::nullopt;
+    return e;
+}
+
+compile_time::hash_t ExportResolver::hash_module_name(std::string_view name) noexcept
+{
+    auto slash = name.find_last_of("\\/");
+    if (slash != std::string_view::npos)
+        name.remove_prefix(slash + 1);
+    if (name.size() > 4)
+    {
+        auto extension = name.substr(name.size() - 4);
+        if (compile_time::run_time::hashi(extension.data(), extension.size()) == compile_time::hashi(".dll"))
+            name.remove_suffix(4);
+    }
+    return compile_time::run_time::hashi(name.data(), name.size());
+}
+
+void ExportResolver::add(const ExportIndex &exports, uint64_t base, std::string_view name)
+{
+    if (name.empty())
+        name = exports.name();
+    _modules[hash_module_name(name)] = Module{ &exports, base, std::string(name) };
+}
+
+void ExportResolver::clear()
+{
+    _modules.clear();
+}
+
+const ExportResolver::Module *ExportResolver::find_module(std::string_view dll, std::string_view importer) const
+{
+    auto it = _modules.find(hash_module_name(dll));
+    if (it != _modules.end())
+        return &it->second;
+    if (_api_sets == nullptr || !ApiSetMap::is_api_set(dll))
+        return nullptr;
+    auto host = _api_sets->resolve(dll, importer);
+    if (host.empty())
+        return nullptr;
+    it = _modules.find(hash_module_name(host));
+    return it == _modules.end() ? nullptr : &it->second;
+}
+
+std::optional<uint64_t> ExportResolver::follow(const Module &module, const PEExport &e, int depth) const
+{
+    if (!e.forwarded())
+        return module.base + e.rva;
+    if (depth >= MaxForwarderDepth)
+        return std::nullopt;
+
+    // "dll.function" or "dll.#ordinal", dll names may contain dots, function names do not
+    auto dot = e.forwarder.rfind('.');
+    if (dot == std::string_view::npos || dot == 0 || dot + 1 == e.forwarder.size())
+        return std::nullopt;
+    auto target = find_module(e.forwarder.substr(0, dot), module.name);
+    if (target == nullptr)
+        return std::nullopt;
+    auto function = e.forwarder.substr(dot + 1);
+    std::optional<PEExport> next;
+    if (function[0] == '#')
+    {
+        uint32_t ordinal = 0;
+        for (auto c : function.substr(1))
+        {
+            if (c < '0' || c > '9' || ordinal > 0xFFFF)
+                return std::nullopt;
+            ordinal = ordinal * 10 + (c - '0');
+        }
+        next = target->exports->find_ordinal(ordinal);
+    }
+    else
+    {
+        next = target->exports->find(function);
+    }
+    if (!next)
+        return std::nullopt;
+    return follow(*target, *next, depth + 1);
+}
+
+std::optional<uint64_t> ExportResolver::resolve(std::string_view dll, std::string_view function, std::string_view importer) const
+{
+    auto module = find_module(dll, importer);
+    if (module == nullptr)
+        return std::nullopt;
+    auto e = module->exports->find(function);
+    if (!e)
+        return std::nullopt;
+    return follow(*module, *e, 0);
+}
+
+std::optional<uint64_t> ExportResolver::resolve(std::string_view dll, uint32_t ordinal, std::string_view importer) const
+{
+    auto module = find_module(dll, importer);
+    if (module == nullptr)
+        return std::nullopt;
+    auto e = module->exports->find_ordinal(ordinal);
+    if (!e)
+        return std::nullopt;
+    return follow(*module, *e, 0);
+}
+
+}
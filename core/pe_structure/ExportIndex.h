@@ -0,0 +1,150 @@
+#pragma once
+
+#include <stdint.h>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../base/compile_time/hash.hpp"
+#include "PEView.h"
+#include "ApiSetMap.h"
+
+namespace pkn
+{
+
+/*
+Export lookups of one image, reusable across any number of resolution passes.
+Names are found by a binary search over the name pointer table, which the linker emits sorted,
+so building the index copies nothing. build(pe, true) adds an open addressing table keyed by
+compile_time::hash of the names, for images looked up many times or by compile time hash only.
+
+usage:
+@code
+ExportIndex kernel32;
+kernel32.build(*PEView::parse(data, size), true);
+auto e = kernel32.find("CreateFileW");
+auto by_hash = kernel32.find(compile_time::hash("GetProcAddress"));
+@endcode
+*/
+class ExportIndex
+{
+public:
+    // the view must outlive the index; false if the export directory is malformed, an image without exports builds an empty index
+    bool build(const PEView &pe, bool hashed = false);
+    void clear();
+public:
+    inline bool valid() const noexcept { return _view.has_value(); }
+    inline const PEView &view() const noexcept { return *_view; }
+    // dll name from the export directory
+    inline std::string_view name() const noexcept { return _name; }
+    inline uint32_t number_of_functions() const noexcept { return _tables.number_of_functions; }
+    inline uint32_t number_of_names() const noexcept { return _tables.number_of_names; }
+    inline bool hashed() const noexcept { return !_slots.empty(); }
+
+    // O(1) if hashed, O(log n) otherwise
+    std::optional<PEExport> find(std::string_view name) const noexcept;
+    // name_hash is compile_time::hash of the name, needs a hashed index
+    std::optional<PEExport> find(compile_time::hash_t name_hash) const noexcept;
+    // ordinal as the import table and GetProcAddress take it, biased by the export base
+    std::optional<PEExport> find_ordinal(uint32_t ordinal) const noexcept;
+private:
+    std::optional<PEExport> named_export(uint32_t name_index) const noexcept;
+    std::string_view name_at(uint32_t name_index) const noexcept;
+private:
+    struct Slot
+    {
+        compile_time::hash_t hash;
+        uint32_t name_index; // NoName if empty
+    };
+    constexpr static uint32_t NoName = 0xFFFFFFFF;
+
+    std::optional<PEView> _view;
+    PEExportTables _tables = {};
+    std::string_view _name;
+    std::vector<Slot> _slots; // power of two, at most half full
+};
+
+/*
+Resolves exports across a set of loaded images, following forwarders("NTDLL.RtlAllocateHeap", "dll.#12")
+from image to image. Images are found by their case insensitive name, with or without the ".dll" extension,
+api set names through the ApiSetMap given to set_api_sets().
+
+usage:
+@code
+ExportResolver resolver;
+resolver.add(ntdll_exports, ntdll_base);
+resolver.add(kernel32_exports, kernel32_base);
+auto heap_alloc = resolver.resolve("kernel32.dll", "HeapAlloc"); // forwarded to ntdll!RtlAllocateHeap
+size_t unresolved = resolver.resolve_imports(pe, [&](const PEImport &import, uint64_t address) { ... });
+@endcode
+*/
+class ExportResolver
+{
+public:
+    constexpr static int MaxForwarderDepth = 16;
+public:
+    // base is where the image is loaded, results are base + rva; name defaults to the export directory name
+    void add(const ExportIndex &exports, uint64_t base, std::string_view name = {});
+    void clear();
+    inline size_t size() const noexcept { return _modules.size(); }
+    // api_sets must outlive the resolver, nullptr disables api set names
+    inline void set_api_sets(const ApiSetMap *api_sets) noexcept { _api_sets = api_sets; }
+    inline const ApiSetMap *api_sets() const noexcept { return _api_sets; }
+public:
+    // importer selects the host when dll is an api set
+    std::optional<uint64_t> resolve(std::string_view dll, std::string_view function, std::string_view importer = {}) const;
+    std::optional<uint64_t> resolve(std::string_view dll, uint32_t ordinal, std::string_view importer = {}) const;
+
+    /*
+    f(const PEImport &, uint64_t address) for every import of pe that resolves, delay loaded ones included.
+    returns the number of imports that did not resolve.
+    */
+    template <class F>
+    size_t resolve_imports(const PEView &pe, F f) const
+    {
+        size_t unresolved = 0;
+        std::string_view last_dll;
+        const Module *module = nullptr;
+        pe.for_each_import([&](const PEImport &import)
+                           {
+                               // imports are grouped by dll
+                               if (import.dll.data() != last_dll.data())
+                               {
+                                   last_dll = import.dll;
+                                   module = find_module(import.dll, pe.export_name());
+                               }
+                               std::optional<uint64_t> address;
+                               if (module != nullptr)
+                               {
+                                   auto e = import.by_name ? module->exports->find(import.name) : module->exports->find_ordinal(import.ordinal);
+                                   if (e)
+                                       address = follow(*module, *e, 0);
+                               }
+                               if (address)
+                                   f(import, *address);
+                               else
+                                   unresolved++;
+                           });
+        return unresolved;
+    }
+public:
+    // compile_time::hashi of a dll name, without its path and ".dll" extension
+    static compile_time::hash_t hash_module_name(std::string_view name) noexcept;
+private:
+    struct Module
+    {
+        const ExportIndex *exports;
+        uint64_t base;
+        std::string name; // the importer of the api sets its exports are forwarded to
+    };
+    // importer selects the host of api set names
+    const Module *find_module(std::string_view dll, std::string_view importer = {}) const;
+    std::optional<uint64_t> follow(const Module &module, const PEExport &e, int depth) const;
+private:
+    std::unordered_map<compile_time::hash_t, Module> _modules;
+    const ApiSetMap *_api_sets = nullptr;
+};
+
+}
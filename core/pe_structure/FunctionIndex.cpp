@@ -0,0 +1,134 @@
+#include "FunctionIndex.h"
+#include "RemotePEImage.h"
+
+#include <algorithm>
+
+namespace pkn
+{
+
+namespace
+{
+
+std::vector<pe_format::RuntimeFunction> read_entries(const pe_format::DataDirectory &dir, const std::function<bool(uint32_t, size_t, void *)> &read)
+{
+    std::vector<pe_format::RuntimeFunction> entries(dir.Size / sizeof(pe_format::RuntimeFunction));
+    if (dir.VirtualAddress == 0 || entries.empty()
+        || !read(dir.VirtualAddress, entries.size() * sizeof(pe_format::RuntimeFunction), entries.data()))
+        return {};
+    return entries;
+}
+
+}
+
+FunctionIndex FunctionIndex::build(const PEView &pe)
+{
+    if (pe.machine() != pe_format::MachineAmd64)
+        return FunctionIndex();
+    auto read = [&pe](uint32_t rva, size_t size, void *buffer)
+    {
+        auto p = pe.at_rva(rva, size);
+        if (p == nullptr)
+            return false;
+        memcpy(buffer, p, size);
+        return true;
+    };
+    return build(read_entries(pe.directory(pe_format::DirectoryException), read), read);
+}
+
+FunctionIndex FunctionIndex::build(RemotePEImage &image)
+{
+    if (image.headers().machine() != pe_format::MachineAmd64)
+        return FunctionIndex();
+    auto read = [&image](uint32_t rva, size_t size, void *buffer)
+    {
+        return image.read(rva, size, buffer);
+    };
+    auto entries = read_entries(image.headers().directory(pe_format::DirectoryException), read);
+
+    // unwind info is spread over .rdata, fetch all of it in one batch before walking the chains
+    std::vector<RvaRange> ranges;
+    ranges.reserve(entries.size());
+    for (auto &e : entries)
+        ranges.push_back(RvaRange{ e.UnwindData & ~1u, sizeof(pe_format::UnwindInfo) });
+    image.prefetch(ranges.data(), ranges.size());
+    return build(std::move(entries), read);
+}
+
+FunctionIndex FunctionIndex::build(const PEMetadata &metadata)
+{
+    FunctionIndex index;
+    size_t count = metadata.function_count();
+    auto functions = metadata.functions();
+    index._begins.resize(count);
+    index._ends.resize(count);
+    index._unwinds.resize(count);
+    index._entries.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        index._begins[i] = functions[i].begin;
+        index._ends[i] = functions[i].end;
+        index._unwinds[i] = functions[i].unwind;
+        index._entries[i] = functions[i].entry;
+    }
+    return index;
+}
+
+FunctionIndex FunctionIndex::build(std::vector<pe_format::RuntimeFunction> entries, const std::function<bool(uint32_t, size_t, void *)> &read)
+{
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [](const pe_format::RuntimeFunction &e)
+                                 {
+                                     return e.BeginAddress >= e.EndAddress;
+                                 }), entries.end());
+    // the linker emits them sorted, which the loader relies on too
+    auto by_begin = [](const pe_format::RuntimeFunction &lhs, const pe_format::RuntimeFunction &rhs)
+    {
+        return lhs.BeginAddress < rhs.BeginAddress;
+    };
+    if (!std::is_sorted(entries.begin(), entries.end(), by_begin))
+        std::stable_sort(entries.begin(), entries.end(), by_begin);
+    entries.erase(std::unique(entries.begin(), entries.end(), [](const pe_format::RuntimeFunction &lhs, const pe_format::RuntimeFunction &rhs)
+                              {
+                                  return lhs.BeginAddress == rhs.BeginAddress;
+                              }), entries.end());
+
+    FunctionIndex index;
+    index._begins.reserve(entries.size());
+    index._ends.reserve(entries.size());
+    index._unwinds.reserve(entries.size());
+    index._entries.reserve(entries.size());
+    for (auto &e : entries)
+    {
+        index._begins.push_back(e.BeginAddress);
+        index._ends.push_back(e.EndAddress);
+        index._unwinds.push_back(e.UnwindData);
+
+        // walk to the primary entry: either an indirect entry(bit 0 of UnwindData)
+        // or UNWIND_INFO flagged with chain info, followed by the parent entry
+        uint32_t entry = e.BeginAddress;
+        uint32_t unwind = e.UnwindData;
+        for (int depth = 0; depth < MaxChainDepth; depth++)
+        {
+            pe_format::RuntimeFunction parent;
+            if (unwind & 1)
+            {
+                if (!read(unwind & ~1u, sizeof(parent), &parent))
+                    break;
+            }
+            else
+            {
+                pe_format::UnwindInfo info;
+                if (!read(unwind, sizeof(info), &info) || ((info.VersionAndFlags >> 3) & pe_format::UnwindFlagChainInfo) == 0)
+                    break;
+                uint32_t codes = ((uint32_t)info.CountOfCodes + 1) & ~1u;
+                if (!read(unwind + sizeof(info) + codes * 2, sizeof(parent), &parent))
+                    break;
+            }
+            entry = parent.BeginAddress;
+            unwind = parent.UnwindData;
+        }
+        index._entries.push_back(entry);
+    }
+    return index;
+}
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "../base/algorithm/branchless_search.hpp"
+#include "PEFormat.h"
+#include "PEView.h"
+#include "PEMetadata.h"
+
+namespace pkn
+{
+
+class RemotePEImage;
+
+struct FunctionRange
+{
+    uint32_t begin;  // the runtime function containing the address
+    uint32_t end;
+    uint32_t unwind;
+    uint32_t entry;  // begin of the function it belongs to, chained unwind info followed
+};
+
+/*
+Function boundaries of an x64 image, from the RUNTIME_FUNCTION entries of its exception directory(.pdata).
+A function split by the compiler has one entry per fragment; every fragment knows the entry point
+of its function, found by following chained unwind info.
+Begins and ends are kept in separate sorted arrays, lookups are branch free binary searches over the
+begins and batch lookups run their searches interleaved, so the cache misses of several lookups overlap.
+Images without an exception directory, or not x64, give an empty index.
+
+usage:
+@code
+auto functions = FunctionIndex::build(*pe);
+if (auto f = functions.find((uint32_t)(rip - module_base)))
+    emulator.run(module_base + f->entry, module_base + f->end);
+@endcode
+*/
+class FunctionIndex
+{
+public:
+    constexpr static size_t NotFound = RangeNotFound;
+    // unwind info chains longer than this are treated as malformed
+    constexpr static int MaxChainDepth = 32;
+public:
+    static FunctionIndex build(const PEView &pe);
+    static FunctionIndex build(RemotePEImage &image);
+    // the index saved in metadata by PEMetadata::build, no unwind info is read
+    static FunctionIndex build(const PEMetadata &metadata);
+    // read(rva, size, buffer) reads unwind info of the image
+    static FunctionIndex build(std::vector<pe_format::RuntimeFunction> entries, const std::function<bool(uint32_t, size_t, void *)> &read);
+public:
+    inline size_t size() const noexcept { return _begins.size(); }
+    inline bool empty() const noexcept { return _begins.empty(); }
+    inline FunctionRange at(size_t index) const noexcept
+    {
+        return FunctionRange{ _begins[index], _ends[index], _unwinds[index], _entries[index] };
+    }
+
+    // index of the runtime function containing rva, NotFound if none
+    inline size_t index_of(uint32_t rva) const noexcept
+    {
+        return branchless_upper_search(_begins.data(), _ends.data(), _begins.size(), rva);
+    }
+    // indexes[i] = index_of(rvas[i]), the searches run interleaved
+    inline void index_of(const uint32_t *rvas, size_t count, size_t *indexes) const noexcept
+    {
+        branchless_upper_search(_begins.data(), _ends.data(), _begins.size(), rvas, count, indexes);
+    }
+
+    inline std::optional<FunctionRange> find(uint32_t rva) const noexcept
+    {
+        size_t index = index_of(rva);
+        if (index == NotFound)
+            return std::nullopt;
+        return at(index);
+    }
+private:
+    std::vector<uint32_t> _begins;
+    std::vector<uint32_t> _ends;
+    std::vector<uint32_t> _unwinds;
+    std::vector<uint32_t> _entries;
+};
+
+}
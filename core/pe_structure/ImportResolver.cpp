@@ -0,0 +1,114 @@
+#include "ImportResolver.h"
+
+#include <string.h>
+#include <algorithm>
+#include <optional>
+
+namespace pkn
+{
+
+size_t BatchImportResolver::KeyHash::operator()(const Key &key) const noexcept
+{
+    auto hash = key.name.empty() ? key.ordinal : compile_time::run_time::hash(key.name.data(), key.name.size());
+    return (size_t)(key.dll * 31 + hash);
+}
+
+void BatchImportResolver::clear()
+{
+    _keys.clear();
+    _lookups.clear();
+    _slots.clear();
+    _images = 0;
+    _unresolved.clear();
+}
+
+bool BatchImportResolver::add(const PEView &pe, uint8_t *image, std::string_view name)
+{
+    if (name.empty())
+        name = pe.export_name();
+    size_t image_index = _images++;
+    auto api_sets = _exports.api_sets();
+    const uint32_t width = pe.is_64bit() ? 8 : 4;
+
+    // imports come grouped by dll, the host is found once per group
+    std::string_view last_dll;
+    std::string_view host;
+    compile_time::hash_t host_hash = 0;
+    return pe.for_each_import([&](const PEImport &import)
+                              {
+                                  if (import.dll.data() != last_dll.data())
+                                  {
+                                      last_dll = import.dll;
+                                      host = import.dll;
+                                      if (api_sets != nullptr && ApiSetMap::is_api_set(import.dll))
+                                      {
+                                          auto resolved = api_sets->resolve(import.dll, name);
+                                          if (!resolved.empty())
+                                              host = resolved;
+                                      }
+                                      host_hash = ExportResolver::hash_module_name(host);
+                                  }
+                                  Key key{ host_hash, import.by_name ? import.name : std::string_view(), import.by_name ? 0u : import.ordinal };
+                                  auto it = _keys.find(key);
+                                  if (it == _keys.end())
+                                  {
+                                      it = _keys.emplace(key, (uint32_t)_lookups.size()).first;
+                                      _lookups.push_back(Lookup{ host, name, import.name, import.ordinal, import.by_name });
+                                  }
+                                  auto offset = pe.rva_to_offset(import.iat_rva, width);
+                                  _slots.push_back(Slot{ offset ? image + *offset : nullptr, it->second, width, image_index, import });
+                              });
+}
+
+ImportResolution BatchImportResolver::resolve()
+{
+    ImportResolution result;
+    result.images = _images;
+    result.imports = _slots.size();
+    result.unique = _lookups.size();
+
+    std::vector<std::optional<uint64_t>> addresses(_lookups.size());
+    for (size_t i = 0; i < _lookups.size(); i++)
+    {
+        auto &lookup = _lookups[i];
+        addresses[i] = lookup.by_name ? _exports.resolve(lookup.dll, lookup.name, lookup.importer) : _exports.resolve(lookup.dll, lookup.ordinal, lookup.importer);
+    }
+
+    // written in address order, slots of one image are contiguous
+    std::sort(_slots.begin(), _slots.end(), [](const Slot &lhs, const Slot &rhs)
+              {
+                  return lhs.target < rhs.target;
+              });
+    for (auto &slot : _slots)
+    {
+        auto &address = addresses[slot.lookup];
+        if (slot.target == nullptr || !address)
+        {
+            _unresolved.push_back(UnresolvedImport{ slot.image, slot.import });
+            result.unresolved++;
+            continue;
+        }
+        if (slot.width == 8)
+        {
+            memcpy(slot.target, &*address, 8);
+        }
+        else
+        {
+            uint32_t value = (uint32_t)*address;
+            memcpy(slot.target, &value, 4);
+        }
+        result.resolved++;
+    }
+    std::sort(_unresolved.begin(), _unresolved.end(), [](const UnresolvedImport &lhs, const UnresolvedImport &rhs)
+              {
+                  return lhs.image < rhs.image;
+              });
+
+    _keys.clear();
+    _lookups.clear();
+    _slots.clear();
+    _images = 0;
+    return result;
+}
+
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ExportIndex.h"
+
+namespace pkn
+{
+
+struct ImportResolution
+{
+    size_t images = 0;
+    size_t imports = 0;    // iat slots queued
+    size_t unique = 0;     // distinct (dll, name or ordinal) looked up
+    size_t resolved = 0;   // iat slots written
+    size_t unresolved = 0;
+};
+
+struct UnresolvedImport
+{
+    size_t image;          // in the order the images were added
+    PEImport import;       // strings view the image
+};
+
+/*
+Resolves the imports of a batch of images at once: iat slots of every image are grouped by
+(dll, name or ordinal), each distinct import is looked up once through an ExportResolver, and the
+results are written to the iat slots in address order.
+Api set dlls are mapped to their host before grouping, so "api-ms-win-core-heap-l1-1-0.dll!HeapAlloc"
+and "kernelbase.dll!HeapAlloc" share one lookup. Delay loaded imports are bound like the others.
+
+usage:
+@code
+BatchImportResolver batch(resolver);
+for (auto &image : images)
+    batch.add(*PEView::parse(image.data(), image.size(), PEView::Layout::Image), image.data(), image.name);
+auto result = batch.resolve();
+for (auto &u : batch.unresolved())
+    printf("%zu: %.*s\n", u.image, (int)u.import.dll.size(), u.import.dll.data());
+@endcode
+*/
+class BatchImportResolver
+{
+public:
+    // exports must outlive this object
+    explicit BatchImportResolver(const ExportResolver &exports) : _exports(exports) {}
+public:
+    /*
+    queues every import of pe; image is the buffer pe views, its iat slots are written by resolve().
+    name is the file name of the image, selecting api set redirections; defaults to its export directory name.
+    pe and image must stay valid until resolve(). false if the import tables are malformed,
+    imports read before the error are still queued.
+    */
+    bool add(const PEView &pe, uint8_t *image, std::string_view name = {});
+    // resolves and writes every queued import, then empties the queue
+    ImportResolution resolve();
+    inline const std::vector<UnresolvedImport> &unresolved() const noexcept { return _unresolved; }
+    void clear();
+private:
+    struct Key
+    {
+        compile_time::hash_t dll;  // ExportResolver::hash_module_name of the host
+        std::string_view name;     // empty for imports by ordinal
+        uint32_t ordinal;
+    public:
+        inline bool operator==(const Key &rhs) const noexcept { return dll == rhs.dll && ordinal == rhs.ordinal && name == rhs.name; }
+    };
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const noexcept;
+    };
+    struct Lookup
+    {
+        std::string_view dll;      // host dll
+        std::string_view importer;
+        std::string_view name;
+        uint32_t ordinal;
+        bool by_name;
+    };
+    struct Slot
+    {
+        uint8_t *target;           // nullptr if the iat slot is not in the buffer
+        uint32_t lookup;
+        uint32_t width;            // 4 or 8
+        size_t image;
+        PEImport import;
+    };
+private:
+    const ExportResolver &_exports;
+    std::unordered_map<Key, uint32_t, KeyHash> _keys;
+    std::vector<Lookup> _lookups;
+    std::vector<Slot> _slots;
+    size_t _images = 0;
+    std::vector<UnresolvedImport> _unresolved;
+};
+
+}
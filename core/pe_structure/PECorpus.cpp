@@ -0,0 +1,359 @@
+#include "PECorpus.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <filesystem>
+#include <tuple>
+
+#include "../base/fs/binary_file.h"
+#include "../session/WorkerPool.h"
+#include "PEView.h"
+
+namespace pkn
+{
+
+namespace
+{
+
+struct ParsedExport
+{
+    std::string name;
+    uint32_t ordinal;
+    uint32_t rva;
+    std::string forwarder;
+};
+
+struct ParsedModule
+{
+    bool ok = false;
+    std::string name;
+    std::string path;
+    PECorpusModule header = {};
+    std::vector<ParsedExport> exports;
+    std::vector<PEMetadataSection> sections;
+    bool has_pdb = false;
+    std::string pdb_path;
+};
+
+inline std::string lower(std::string_view s)
+{
+    std::string result(s);
+    for (auto &c : result)
+        if (c >= 'A' && c <= 'Z')
+            c = (char)(c - 'A' + 'a');
+    return result;
+}
+
+void parse_module(const std::string &file_path, ParsedModule &module)
+{
+    auto file = MappedFile::open(file_path);
+    if (file == nullptr)
+        return;
+    auto pe = PEView::parse(file->data(), file->size());
+    if (!pe)
+        return;
+    auto &header = module.header;
+    header.timestamp = pe->timestamp();
+    header.image_size = pe->image_size();
+    header.checksum = pe->checksum();
+    header.machine = pe->machine();
+    header.characteristics = pe->characteristics();
+    header.image_base = pe->image_base();
+
+    for (size_t i = 0; i < pe->section_count(); i++)
+    {
+        auto s = pe->section(i);
+        PEMetadataSection section;
+        memcpy(section.name, s.Name, sizeof(section.name));
+        section.virtual_address = s.VirtualAddress;
+        section.virtual_size = s.VirtualSize;
+        section.raw_address = s.PointerToRawData;
+        section.raw_size = s.SizeOfRawData;
+        section.characteristics = s.Characteristics;
+        module.sections.push_back(section);
+    }
+    // a malformed export directory still indexes the exports read before the error
+    pe->for_each_export([&](const PEExport &e)
+                        {
+                            module.exports.push_back(ParsedExport{ std::string(e.name), e.ordinal, e.rva, std::string(e.forwarder) });
+                        });
+    if (auto codeview = pe->codeview())
+    {
+        module.has_pdb = true;
+        memcpy(header.pdb_guid, codeview->guid, sizeof(header.pdb_guid));
+        header.pdb_age = codeview->age;
+        module.pdb_path = std::string(codeview->pdb_path);
+    }
+    module.ok = true;
+}
+
+}
+
+std::optional<PECorpusStats> PECorpus::build(const std::string &root, const std::string &output, const PECorpusOptions &options)
+{
+    namespace fs = std::filesystem;
+    std::vector<std::string> extensions;
+    for (auto &extension : options.extensions)
+        extensions.push_back(lower(extension));
+
+    // no exceptions: every filesystem call reports through error codes, unreadable directories are skipped
+    std::vector<std::pair<std::string, std::string>> files; // path, relative path
+    std::error_code ec;
+    fs::path root_path(root);
+    for (fs::recursive_directory_iterator it(root_path, fs::directory_options::skip_permission_denied, ec), end; !ec && it != end; it.increment(ec))
+    {
+        std::error_code entry_ec;
+        if (!it->is_regular_file(entry_ec))
+            continue;
+        auto extension = lower(it->path().extension().string());
+        if (std::find(extensions.begin(), extensions.end(), extension) == extensions.end())
+            continue;
+        files.emplace_back(it->path().string(), it->path().lexically_relative(root_path).generic_string());
+    }
+
+    PECorpusStats stats;
+    stats.files = files.size();
+    std::vector<ParsedModule> parsed(files.size());
+    {
+        constexpr size_t FilesPerTask = 16;
+        WorkerPool pool(options.threads);
+        auto queue = pool.create_queue();
+        for (size_t begin = 0; begin < files.size(); begin += FilesPerTask)
+        {
+            size_t end = std::min(begin + FilesPerTask, files.size());
+            queue->submit([&, begin, end]()
+                          {
+                              for (size_t i = begin; i < end; i++)
+                                  parse_module(files[i].first, parsed[i]);
+                          });
+        }
+        queue->wait();
+    }
+
+    StringPool strings;
+    std::vector<uint32_t> order;
+    for (uint32_t i = 0; i < parsed.size(); i++)
+    {
+        if (!parsed[i].ok)
+            continue;
+        parsed[i].path = files[i].second;
+        parsed[i].name = lower(fs::path(files[i].first).filename().string());
+        order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs)
+              {
+                  return std::tie(parsed[lhs].name, parsed[lhs].path) < std::tie(parsed[rhs].name, parsed[rhs].path);
+              });
+
+    std::vector<PECorpusModule> modules;
+    std::vector<PECorpusExport> exports;
+    std::vector<uint32_t> ordinals;
+    std::vector<PEMetadataSection> sections;
+    std::vector<PECorpusSymbol> symbols;
+    modules.reserve(order.size());
+    for (auto i : order)
+    {
+        auto &m = parsed[i];
+        auto header = m.header;
+        header.name = strings.add(m.name);
+        header.path = strings.add(m.path);
+        header.pdb_path = m.has_pdb ? strings.add(m.pdb_path) : NoString;
+
+        // named exports sorted by name as the name table is, then ordinal only ones
+        std::stable_sort(m.exports.begin(), m.exports.end(), [](const ParsedExport &lhs, const ParsedExport &rhs)
+                         {
+                             if (lhs.name.empty() != rhs.name.empty())
+                                 return !lhs.name.empty();
+                             if (lhs.name.empty())
+                                 return lhs.ordinal < rhs.ordinal;
+                             return lhs.name < rhs.name;
+                         });
+        header.first_export = (uint32_t)exports.size();
+        header.export_count = (uint32_t)m.exports.size();
+        header.named_export_count = 0;
+        for (auto &e : m.exports)
+        {
+            PECorpusExport exported;
+            exported.name = e.name.empty() ? NoString : strings.add(e.name);
+            exported.ordinal = e.ordinal;
+            exported.rva = e.rva;
+            exported.forwarder = e.forwarder.empty() ? NoString : strings.add(e.forwarder);
+            if (!e.name.empty())
+            {
+                header.named_export_count++;
+                symbols.push_back(PECorpusSymbol{ exported.name, (uint32_t)modules.size(), (uint32_t)exports.size() });
+            }
+            exports.push_back(exported);
+        }
+        size_t first_ordinal = ordinals.size();
+        for (uint32_t k = 0; k < header.export_count; k++)
+            ordinals.push_back(k);
+        std::stable_sort(ordinals.begin() + first_ordinal, ordinals.end(), [&](uint32_t lhs, uint32_t rhs)
+                         {
+                             return exports[header.first_export + lhs].ordinal < exports[header.first_export + rhs].ordinal;
+                         });
+
+        header.first_section = (uint32_t)sections.size();
+        header.section_count = (uint32_t)m.sections.size();
+        sections.insert(sections.end(), m.sections.begin(), m.sections.end());
+        modules.push_back(header);
+        stats.exports += m.exports.size();
+    }
+    stats.modules = modules.size();
+    std::sort(symbols.begin(), symbols.end(), [&](const PECorpusSymbol &lhs, const PECorpusSymbol &rhs)
+              {
+                  int order = strings.at(lhs.name).compare(strings.at(rhs.name));
+                  return order != 0 ? order < 0 : lhs.module < rhs.module;
+              });
+
+    FileHeader header = {};
+    memcpy(header.magic, PECorpusMagic, sizeof(header.magic));
+    header.version = PECorpusVersion;
+    header.module_count = (uint32_t)modules.size();
+    header.export_count = (uint32_t)exports.size();
+    header.section_count = (uint32_t)sections.size();
+    header.symbol_count = (uint32_t)symbols.size();
+    header.string_size = (uint32_t)strings.data().size();
+    uint64_t offset = align8(sizeof(header));
+    auto place = [&](uint64_t &table, size_t bytes)
+    {
+        table = offset;
+        offset = align8(offset + bytes);
+    };
+    place(header.modules, modules.size() * sizeof(PECorpusModule));
+    place(header.exports, exports.size() * sizeof(PECorpusExport));
+    place(header.ordinals, ordinals.size() * sizeof(uint32_t));
+    place(header.sections, sections.size() * sizeof(PEMetadataSection));
+    place(header.symbols, symbols.size() * sizeof(PECorpusSymbol));
+    place(header.strings, strings.data().size());
+
+    auto write_tables = [&](FILE *file)
+    {
+        uint64_t position = 0;
+        bool success = true;
+        auto write = [&](uint64_t table, const void *data, size_t bytes)
+        {
+            static const uint8_t padding[8] = {};
+            success = success && fwrite(padding, 1, (size_t)(table - position), file) == table - position;
+            success = success && (bytes == 0 || fwrite(data, 1, bytes, file) == bytes);
+            position = table + bytes;
+        };
+        write(0, &header, sizeof(header));
+        write(header.modules, modules.data(), modules.size() * sizeof(PECorpusModule));
+        write(header.exports, exports.data(), exports.size() * sizeof(PECorpusExport));
+        write(header.ordinals, ordinals.data(), ordinals.size() * sizeof(uint32_t));
+        write(header.sections, sections.data(), sections.size() * sizeof(PEMetadataSection));
+        write(header.symbols, symbols.data(), symbols.size() * sizeof(PECorpusSymbol));
+        write(header.strings, strings.data().data(), strings.data().size());
+        return success;
+    };
+    // written through a temporary file, a failed build keeps the previous database
+    if (!write_file_replacing(output, write_tables))
+        return std::nullopt;
+    return stats;
+}
+
+std::unique_ptr<PECorpus> PECorpus::open(const std::string &path)
+{
+    std::unique_ptr<PECorpus> corpus(new PECorpus());
+    corpus->_file = MappedFile::open(path);
+    if (corpus->_file == nullptr)
+        return nullptr;
+    auto data = corpus->_file->data();
+    auto size = corpus->_file->size();
+    auto &header = corpus->_header;
+    if (size < sizeof(header))
+        return nullptr;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, PECorpusMagic, sizeof(header.magic)) != 0 || header.version != PECorpusVersion)
+        return nullptr;
+    auto inside = [&](uint64_t offset, uint64_t count, size_t record_size)
+    {
+        return offset % 4 == 0 && offset <= size && count * record_size <= size - offset;
+    };
+    if (!inside(header.modules, header.module_count, sizeof(PECorpusModule))
+        || !inside(header.exports, header.export_count, sizeof(PECorpusExport))
+        || !inside(header.ordinals, header.export_count, sizeof(uint32_t))
+        || !inside(header.sections, header.section_count, sizeof(PEMetadataSection))
+        || !inside(header.symbols, header.symbol_count, sizeof(PECorpusSymbol))
+        || !inside(header.strings, header.string_size, 1)
+        || header.string_size == 0 || data[header.strings + header.string_size - 1] != '\0')
+        return nullptr;
+    corpus->_modules = (const PECorpusModule *)(data + header.modules);
+    corpus->_exports = (const PECorpusExport *)(data + header.exports);
+    corpus->_ordinals = (const uint32_t *)(data + header.ordinals);
+    corpus->_sections = (const PEMetadataSection *)(data + header.sections);
+    corpus->_symbols = (const PECorpusSymbol *)(data + header.symbols);
+    corpus->_strings = (const char *)data + header.strings;
+
+    // ranges of every module are checked once here, lookups then index the tables freely
+    for (uint32_t i = 0; i < header.module_count; i++)
+    {
+        auto &m = corpus->_modules[i];
+        if ((uint64_t)m.first_export + m.export_count > header.export_count
+            || m.named_export_count > m.export_count
+            || (uint64_t)m.first_section + m.section_count > header.section_count)
+            return nullptr;
+        for (uint32_t k = 0; k < m.export_count; k++)
+            if (corpus->_ordinals[m.first_export + k] >= m.export_count)
+                return nullptr;
+    }
+    for (uint32_t i = 0; i < header.symbol_count; i++)
+    {
+        auto &s = corpus->_symbols[i];
+        if (s.module >= header.module_count || s.export_index >= header.export_count)
+            return nullptr;
+    }
+    return corpus;
+}
+
+std::vector<const PECorpusModule *> PECorpus::find_modules(std::string_view name) const
+{
+    auto key = lower(name);
+    auto first = std::lower_bound(_modules, _modules + module_count(), key, [this](const PECorpusModule &m, const std::string &key)
+                                  {
+                                      return string(m.name) < key;
+                                  });
+    std::vector<const PECorpusModule *> result;
+    for (auto it = first; it != _modules + module_count() && string(it->name) == key; ++it)
+        result.push_back(it);
+    return result;
+}
+
+const PECorpusExport *PECorpus::find_export(const PECorpusModule &module, std::string_view name) const noexcept
+{
+    auto first = _exports + module.first_export;
+    auto last = first + module.named_export_count;
+    auto it = std::lower_bound(first, last, name, [this](const PECorpusExport &e, std::string_view name)
+                               {
+                                   return string(e.name) < name;
+                               });
+    return (it != last && string(it->name) == name) ? it : nullptr;
+}
+
+const PECorpusExport *PECorpus::find_export(const PECorpusModule &module, uint32_t ordinal) const noexcept
+{
+    auto exports = _exports + module.first_export;
+    auto first = _ordinals + module.first_export;
+    auto last = first + module.export_count;
+    auto it = std::lower_bound(first, last, ordinal, [exports](uint32_t index, uint32_t ordinal)
+                               {
+                                   return exports[index].ordinal < ordinal;
+                               });
+    return (it != last && exports[*it].ordinal == ordinal) ? exports + *it : nullptr;
+}
+
+std::vector<std::pair<const PECorpusModule *, const PECorpusExport *>> PECorpus::find_symbol(std::string_view name) const
+{
+    auto first = std::lower_bound(_symbols, _symbols + _header.symbol_count, name, [this](const PECorpusSymbol &s, std::string_view name)
+                                  {
+                                      return string(s.name) < name;
+                                  });
+    std::vector<std::pair<const PECorpusModule *, const PECorpusExport *>> result;
+    for (auto it = first; it != _symbols + _header.symbol_count && string(it->name) == name; ++it)
+        result.emplace_back(_modules + it->module, _exports + it->export_index);
+    return result;
+}
+
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../base/noncopyable.h"
+#include "../base/fs/MappedFile.h"
+#include "PEMetadata.h"
+
+namespace pkn
+{
+
+constexpr const char PECorpusMagic[8] = { 'P', 'K', 'N', 'P', 'E', 'D', 'B', '\0' };
+constexpr const uint32_t PECorpusVersion = 1;
+
+#pragma pack(push, 4)
+struct PECorpusModule
+{
+    uint32_t name;            // string offset, lower case file name
+    uint32_t path;            // string offset, relative to the indexed root, '/' separated
+    uint32_t timestamp;
+    uint32_t image_size;
+    uint32_t checksum;
+    uint16_t machine;
+    uint16_t characteristics;
+    uint64_t image_base;
+    uint32_t first_export;    // into the export and the ordinal tables; named exports sorted by name, then ordinal only ones
+    uint32_t export_count;
+    uint32_t named_export_count;
+    uint32_t first_section;
+    uint32_t section_count;
+    uint8_t pdb_guid[16];
+    uint32_t pdb_age;
+    uint32_t pdb_path;        // string offset, PECorpus::NoString if the image has no CodeView entry
+};
+
+struct PECorpusExport
+{
+    uint32_t name;            // string offset, PECorpus::NoString if exported by ordinal only
+    uint32_t ordinal;
+    uint32_t rva;
+    uint32_t forwarder;       // string offset, PECorpus::NoString if not forwarded
+};
+
+// one named export of the corpus, sorted by name then by module
+struct PECorpusSymbol
+{
+    uint32_t name;
+    uint32_t module;
+    uint32_t export_index;    // into the export table
+};
+#pragma pack(pop)
+
+struct PECorpusOptions
+{
+    // compared case insensitively
+    std::vector<std::string> extensions = { ".dll", ".sys", ".exe", ".drv", ".cpl", ".ocx" };
+    // 0: one less than the number of hardware threads
+    size_t threads = 0;
+};
+
+struct PECorpusStats
+{
+    size_t files = 0;         // candidates found below the root
+    size_t modules = 0;       // files parsed as PE images
+    size_t exports = 0;
+};
+
+/*
+A database of the exports, section layouts and pdb identities of every image below a directory,
+built in parallel and written as one sorted file that is mapped for queries.
+Modules are sorted by name, the exports of a module by name and every named export of the corpus
+is in a global table sorted by name, so every lookup is a binary search.
+
+usage:
+@code
+PECorpus::build("/mnt/win10_22h2/Windows/System32", "system32.pedb");
+auto corpus = PECorpus::open("system32.pedb");
+for (auto &module : corpus->find_modules("ntdll.dll"))
+    if (auto e = corpus->find_export(*module, "NtOpenProcess"))
+        printf("%x\n", e->rva);
+for (auto &symbol : corpus->find_symbol("CreateFileW"))
+    printf("%s\n", corpus->string(symbol.first->name).data());
+@endcode
+*/
+class PECorpus : noncopyable
+{
+public:
+    constexpr static uint32_t NoString = 0xFFFFFFFF;
+public:
+    // indexes root recursively and writes the database to output, nullopt if it can not be written
+    static std::optional<PECorpusStats> build(const std::string &root, const std::string &output, const PECorpusOptions &options = PECorpusOptions());
+    // nullptr if the file can not be mapped or is not a valid database
+    static std::unique_ptr<PECorpus> open(const std::string &path);
+public:
+    inline size_t module_count() const noexcept { return _header.module_count; }
+    inline const PECorpusModule &module(size_t index) const noexcept { return _modules[index]; }
+    inline const PECorpusExport *exports(const PECorpusModule &module) const noexcept { return _exports + module.first_export; }
+    inline const PEMetadataSection *sections(const PECorpusModule &module) const noexcept { return _sections + module.first_section; }
+
+    // modules with this file name, compared case insensitively
+    std::vector<const PECorpusModule *> find_modules(std::string_view name) const;
+    const PECorpusExport *find_export(const PECorpusModule &module, std::string_view name) const noexcept;
+    const PECorpusExport *find_export(const PECorpusModule &module, uint32_t ordinal) const noexcept;
+    // every module exporting name
+    std::vector<std::pair<const PECorpusModule *, const PECorpusExport *>> find_symbol(std::string_view name) const;
+
+    // empty for NoString
+    inline std::string_view string(uint32_t offset) const noexcept
+    {
+        if (offset >= _header.string_size)
+            return {};
+        return std::string_view(_strings + offset);
+    }
+private:
+    PECorpus() = default;
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t module_count;
+        uint32_t export_count;
+        uint32_t section_count;
+        uint32_t symbol_count;
+        uint32_t string_size;     // the last byte of the pool is 0
+        uint64_t modules;         // table offsets in the file
+        uint64_t exports;
+        uint64_t ordinals;        // per module, indexes of its exports sorted by ordinal
+        uint64_t sections;
+        uint64_t symbols;
+        uint64_t strings;
+    };
+private:
+    std::unique_ptr<MappedFile> _file;
+    FileHeader _header = {};
+    const PECorpusModule *_modules = nullptr;
+    const PECorpusExport *_exports = nullptr;
+    const uint32_t *_ordinals = nullptr;
+    const PEMetadataSection *_sections = nullptr;
+    const PECorpusSymbol *_symbols = nullptr;
+    const char *_strings = nullptr;
+};
+
+}
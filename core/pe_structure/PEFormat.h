@@ -0,0 +1,284 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+On-disk PE structures, without any dependency on Windows headers,
+so PE files can be parsed on any platform.
+Fields follow the PE/COFF specification, all little endian.
+*/
+
+namespace pkn
+{
+namespace pe_format
+{
+
+constexpr uint16_t DosSignature = 0x5A4D;         // MZ
+constexpr uint32_t NtSignature = 0x00004550;      // PE\0\0
+constexpr uint16_t OptionalHeader32Magic = 0x10B;
+constexpr uint16_t OptionalHeader64Magic = 0x20B;
+constexpr uint64_t OrdinalFlag32 = 0x80000000ull;
+constexpr uint64_t OrdinalFlag64 = 0x8000000000000000ull;
+constexpr uint32_t NumberOfDirectoryEntries = 16;
+constexpr uint16_t MachineI386 = 0x014C;
+constexpr uint16_t MachineAmd64 = 0x8664;
+constexpr uint8_t UnwindFlagChainInfo = 0x04; // UNWIND_INFO is followed by the RuntimeFunction it continues
+constexpr uint32_t DebugTypeCodeView = 2;
+constexpr uint32_t CodeViewRsdsSignature = 0x53445352; // RSDS
+
+enum DirectoryEntry : uint32_t
+{
+    DirectoryExport = 0,
+    DirectoryImport = 1,
+    DirectoryResource = 2,
+    DirectoryException = 3,
+    DirectorySecurity = 4,
+    DirectoryBaseReloc = 5,
+    DirectoryDebug = 6,
+    DirectoryArchitecture = 7,
+    DirectoryGlobalPtr = 8,
+    DirectoryTls = 9,
+    DirectoryLoadConfig = 10,
+    DirectoryBoundImport = 11,
+    DirectoryIat = 12,
+    DirectoryDelayImport = 13,
+    DirectoryComDescriptor = 14,
+};
+
+enum SectionCharacteristic : uint32_t
+{
+    SectionCode = 0x00000020,
+    SectionInitializedData = 0x00000040,
+    SectionUninitializedData = 0x00000080,
+    SectionMemoryDiscardable = 0x02000000,
+    SectionMemoryExecute = 0x20000000,
+    SectionMemoryRead = 0x40000000,
+    SectionMemoryWrite = 0x80000000,
+};
+
+#pragma pack(push, 1)
+
+struct DosHeader
+{
+    uint16_t e_magic;
+    uint16_t e_cblp;
+    uint16_t e_cp;
+    uint16_t e_crlc;
+    uint16_t e_cparhdr;
+    uint16_t e_minalloc;
+    uint16_t e_maxalloc;
+    uint16_t e_ss;
+    uint16_t e_sp;
+    uint16_t e_csum;
+    uint16_t e_ip;
+    uint16_t e_cs;
+    uint16_t e_lfarlc;
+    uint16_t e_ovno;
+    uint16_t e_res[4];
+    uint16_t e_oemid;
+    uint16_t e_oeminfo;
+    uint16_t e_res2[10];
+    int32_t e_lfanew;
+};
+
+struct FileHeader
+{
+    uint16_t Machine;
+    uint16_t NumberOfSections;
+    uint32_t TimeDateStamp;
+    uint32_t PointerToSymbolTable;
+    uint32_t NumberOfSymbols;
+    uint16_t SizeOfOptionalHeader;
+    uint16_t Characteristics;
+};
+
+struct DataDirectory
+{
+    uint32_t VirtualAddress;
+    uint32_t Size;
+};
+
+// the fields both optional headers share, up to SizeOfImage; ImageBase and BaseOfData differ
+struct OptionalHeader32
+{
+    uint16_t Magic;
+    uint8_t MajorLinkerVersion;
+    uint8_t MinorLinkerVersion;
+    uint32_t SizeOfCode;
+    uint32_t SizeOfInitializedData;
+    uint32_t SizeOfUninitializedData;
+    uint32_t AddressOfEntryPoint;
+    uint32_t BaseOfCode;
+    uint32_t BaseOfData;
+    uint32_t ImageBase;
+    uint32_t SectionAlignment;
+    uint32_t FileAlignment;
+    uint16_t MajorOperatingSystemVersion;
+    uint16_t MinorOperatingSystemVersion;
+    uint16_t MajorImageVersion;
+    uint16_t MinorImageVersion;
+    uint16_t MajorSubsystemVersion;
+    uint16_t MinorSubsystemVersion;
+    uint32_t Win32VersionValue;
+    uint32_t SizeOfImage;
+    uint32_t SizeOfHeaders;
+    uint32_t CheckSum;
+    uint16_t Subsystem;
+    uint16_t DllCharacteristics;
+    uint32_t SizeOfStackReserve;
+    uint32_t SizeOfStackCommit;
+    uint32_t SizeOfHeapReserve;
+    uint32_t SizeOfHeapCommit;
+    uint32_t LoaderFlags;
+    uint32_t NumberOfRvaAndSizes;
+    // followed by NumberOfRvaAndSizes DataDirectory
+};
+
+struct OptionalHeader64
+{
+    uint16_t Magic;
+    uint8_t MajorLinkerVersion;
+    uint8_t MinorLinkerVersion;
+    uint32_t SizeOfCode;
+    uint32_t SizeOfInitializedData;
+    uint32_t SizeOfUninitializedData;
+    uint32_t AddressOfEntryPoint;
+    uint32_t BaseOfCode;
+    uint64_t ImageBase;
+    uint32_t SectionAlignment;
+    uint32_t FileAlignment;
+    uint16_t MajorOperatingSystemVersion;
+    uint16_t MinorOperatingSystemVersion;
+    uint16_t MajorImageVersion;
+    uint16_t MinorImageVersion;
+    uint16_t MajorSubsystemVersion;
+    uint16_t MinorSubsystemVersion;
+    uint32_t Win32VersionValue;
+    uint32_t SizeOfImage;
+    uint32_t SizeOfHeaders;
+    uint32_t CheckSum;
+    uint16_t Subsystem;
+    uint16_t DllCharacteristics;
+    uint64_t SizeOfStackReserve;
+    uint64_t SizeOfStackCommit;
+    uint64_t SizeOfHeapReserve;
+    uint64_t SizeOfHeapCommit;
+    uint32_t LoaderFlags;
+    uint32_t NumberOfRvaAndSizes;
+    // followed by NumberOfRvaAndSizes DataDirectory
+};
+
+struct SectionHeader
+{
+    char Name[8]; // not null terminated if 8 characters long
+    uint32_t VirtualSize;
+    uint32_t VirtualAddress;
+    uint32_t SizeOfRawData;
+    uint32_t PointerToRawData;
+    uint32_t PointerToRelocations;
+    uint32_t PointerToLinenumbers;
+    uint16_t NumberOfRelocations;
+    uint16_t NumberOfLinenumbers;
+    uint32_t Characteristics;
+};
+
+struct ImportDescriptor
+{
+    uint32_t OriginalFirstThunk; // import lookup table
+    uint32_t TimeDateStamp;
+    uint32_t ForwarderChain;
+    uint32_t Name;
+    uint32_t FirstThunk;         // import address table
+};
+
+struct DelayImportDescriptor
+{
+    uint32_t Attributes;
+    uint32_t DllNameRVA;
+    uint32_t ModuleHandleRVA;
+    uint32_t ImportAddressTableRVA;
+    uint32_t ImportNameTableRVA;
+    uint32_t BoundImportAddressTableRVA;
+    uint32_t UnloadInformationTableRVA;
+    uint32_t TimeDateStamp;
+};
+
+struct ExportDirectory
+{
+    uint32_t Characteristics;
+    uint32_t TimeDateStamp;
+    uint16_t MajorVersion;
+    uint16_t MinorVersion;
+    uint32_t Name;
+    uint32_t Base;
+    uint32_t NumberOfFunctions;
+    uint32_t NumberOfNames;
+    uint32_t AddressOfFunctions;
+    uint32_t AddressOfNames;
+    uint32_t AddressOfNameOrdinals;
+};
+
+struct BaseRelocation
+{
+    uint32_t VirtualAddress;
+    uint32_t SizeOfBlock;
+    // followed by (SizeOfBlock - 8) / 2 uint16_t entries: type << 12 | offset
+};
+
+struct DebugDirectory
+{
+    uint32_t Characteristics;
+    uint32_t TimeDateStamp;
+    uint16_t MajorVersion;
+    uint16_t MinorVersion;
+    uint32_t Type;
+    uint32_t SizeOfData;
+    uint32_t AddressOfRawData;
+    uint32_t PointerToRawData;
+};
+
+// CodeView record of a DebugTypeCodeView entry, PDB 7.0 format
+struct CodeViewRsds
+{
+    uint32_t Signature; // CodeViewRsdsSignature
+    uint8_t Guid[16];
+    uint32_t Age;
+    // followed by the null terminated path of the pdb
+};
+
+// x64 exception directory entry
+struct RuntimeFunction
+{
+    uint32_t BeginAddress;
+    uint32_t EndAddress;
+    uint32_t UnwindData; // rva of UNWIND_INFO, of another RuntimeFunction if bit 0 is set
+};
+
+// x64 UNWIND_INFO header
+struct UnwindInfo
+{
+    uint8_t VersionAndFlags; // version in bits 0-2, flags in bits 3-7
+    uint8_t SizeOfProlog;
+    uint8_t CountOfCodes;
+    uint8_t FrameRegisterAndOffset;
+    // followed by CountOfCodes uint16_t codes, padded to an even count
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(DosHeader) == 64, "");
+static_assert(sizeof(FileHeader) == 20, "");
+static_assert(sizeof(OptionalHeader32) == 96, "");
+static_assert(sizeof(OptionalHeader64) == 112, "");
+static_assert(sizeof(SectionHeader) == 40, "");
+static_assert(sizeof(ImportDescriptor) == 20, "");
+static_assert(sizeof(DelayImportDescriptor) == 32, "");
+static_assert(sizeof(ExportDirectory) == 40, "");
+static_assert(sizeof(BaseRelocation) == 8, "");
+static_assert(sizeof(DebugDirectory) == 28, "");
+static_assert(sizeof(CodeViewRsds) == 24, "");
+static_assert(sizeof(RuntimeFunction) == 12, "");
+static_assert(sizeof(UnwindInfo) == 4, "");
+
+}
+}
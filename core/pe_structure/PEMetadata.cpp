@@ -0,0 +1,173 @@
+#include "PEMetadata.h"
+#include "FunctionIndex.h"
+#include "../base/fs/binary_file.h"
+
+#include <algorithm>
+#include <string>
+
+namespace pkn
+{
+
+namespace
+{
+
+constexpr uint64_t FnvBasis = 14695981039346656037ull;
+constexpr uint64_t FnvPrime = 1099511628211ull;
+
+inline uint64_t fnv1a(uint64_t hash, const uint8_t *data, size_t size) noexcept
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= data[i];
+        hash *= FnvPrime;
+    }
+    return hash;
+}
+
+}
+
+PEMetadataKey PEMetadataKey::of(const PEView &pe) noexcept
+{
+    constexpr size_t Samples = 64;
+    constexpr size_t SampleSize = 256;
+    PEMetadataKey key;
+    key.timestamp = pe.timestamp();
+    key.image_size = pe.image_size();
+
+    uint64_t size = pe.size();
+    uint64_t hash = fnv1a(FnvBasis, (const uint8_t *)&size, sizeof(size));
+    hash = fnv1a(hash, pe.data(), std::min<size_t>({ (size_t)pe.size_of_headers(), pe.size(), 0x1000 }));
+    if (pe.size() > SampleSize)
+    {
+        size_t stride = (pe.size() - SampleSize) / Samples;
+        for (size_t i = 0; i < Samples; i++)
+            hash = fnv1a(hash, pe.data() + i * stride, SampleSize);
+    }
+    key.content_hash = hash;
+    return key;
+}
+
+std::shared_ptr<PEMetadata> PEMetadata::build(const PEView &pe)
+{
+    auto metadata = std::make_shared<PEMetadata>();
+    auto &header = metadata->_header;
+    header.flags = pe.is_64bit() ? FlagPE32Plus : 0;
+    header.key = PEMetadataKey::of(pe);
+    header.image_base = pe.image_base();
+    header.entry_point_rva = pe.entry_point_rva();
+    header.size_of_headers = pe.size_of_headers();
+    header.checksum = pe.checksum();
+    header.machine = pe.machine();
+    header.subsystem = pe.subsystem();
+    header.dll_characteristics = pe.dll_characteristics();
+
+    // dll names repeat for every import, keys view the strings of the PE buffer
+    StringPool strings;
+    std::vector<PEMetadataSection> sections;
+    sections.reserve(pe.section_count());
+    for (size_t i = 0; i < pe.section_count(); i++)
+    {
+        auto s = pe.section(i);
+        PEMetadataSection section;
+        memcpy(section.name, s.Name, sizeof(section.name));
+        section.virtual_address = s.VirtualAddress;
+        section.virtual_size = s.VirtualSize;
+        section.raw_address = s.PointerToRawData;
+        section.raw_size = s.SizeOfRawData;
+        section.characteristics = s.Characteristics;
+        sections.push_back(section);
+    }
+
+    std::vector<PEMetadataImport> imports;
+    pe.for_each_import([&](const PEImport &i)
+                       {
+                           PEMetadataImport import = {};
+                           import.dll = strings.add(i.dll);
+                           import.name = i.by_name ? strings.add(i.name) : NoString;
+                           import.iat_rva = i.iat_rva;
+                           import.hint = i.hint;
+                           import.ordinal = i.ordinal;
+                           import.by_name = i.by_name;
+                           import.delayed = i.delayed;
+                           imports.push_back(import);
+                       });
+
+    std::vector<PEMetadataExport> exports;
+    pe.for_each_export([&](const PEExport &e)
+                       {
+                           PEMetadataExport exported;
+                           exported.name = e.name.empty() ? NoString : strings.add(e.name);
+                           exported.forwarder = e.forwarded() ? strings.add(e.forwarder) : NoString;
+                           exported.ordinal = e.ordinal;
+                           exported.rva = e.rva;
+                           exports.push_back(exported);
+                       });
+
+    auto index = FunctionIndex::build(pe);
+    std::vector<PEMetadataFunction> functions(index.size());
+    for (size_t i = 0; i < index.size(); i++)
+    {
+        auto f = index.at(i);
+        functions[i] = PEMetadataFunction{ f.begin, f.end, f.unwind, f.entry };
+    }
+
+    // header, then every table 8 bytes aligned
+    size_t size = align8(sizeof(BlobHeader));
+    auto place = [&](Table &t, size_t count, size_t record_size)
+    {
+        t.offset = (uint32_t)size;
+        t.count = (uint32_t)count;
+        size = align8(size + count * record_size);
+    };
+    place(header.sections, sections.size(), sizeof(PEMetadataSection));
+    place(header.imports, imports.size(), sizeof(PEMetadataImport));
+    place(header.exports, exports.size(), sizeof(PEMetadataExport));
+    place(header.functions, functions.size(), sizeof(PEMetadataFunction));
+    place(header.strings, strings.data().size() + 1, 1);
+    header.size = (uint32_t)size;
+
+    auto &blob = metadata->_owned;
+    blob.assign(size, 0);
+    auto copy = [&](const Table &t, const auto &records)
+    {
+        if (!records.empty())
+            memcpy(blob.data() + t.offset, records.data(), records.size() * sizeof(records[0]));
+    };
+    memcpy(blob.data(), &header, sizeof(header));
+    copy(header.sections, sections);
+    copy(header.imports, imports);
+    copy(header.exports, exports);
+    copy(header.functions, functions);
+    copy(header.strings, strings.data());
+    metadata->_blob = blob.data();
+    return metadata;
+}
+
+std::shared_ptr<PEMetadata> PEMetadata::view(const uint8_t *blob, size_t size, std::shared_ptr<const void> keep_alive)
+{
+    if (blob == nullptr || size < sizeof(BlobHeader) || ((uintptr_t)blob & 3) != 0)
+        return nullptr;
+    auto metadata = std::make_shared<PEMetadata>();
+    auto &header = metadata->_header;
+    memcpy(&header, blob, sizeof(header));
+    if (header.size > size || header.size < sizeof(BlobHeader))
+        return nullptr;
+    auto inside = [&](const Table &t, size_t record_size)
+    {
+        return t.offset >= sizeof(BlobHeader) && t.offset <= header.size && (t.offset & 3) == 0
+            && (uint64_t)t.count * record_size <= header.size - t.offset;
+    };
+    if (!inside(header.sections, sizeof(PEMetadataSection))
+        || !inside(header.imports, sizeof(PEMetadataImport))
+        || !inside(header.exports, sizeof(PEMetadataExport))
+        || !inside(header.functions, sizeof(PEMetadataFunction))
+        || !inside(header.strings, 1)
+        || header.strings.count == 0
+        || blob[header.strings.offset + header.strings.count - 1] != '\0')
+        return nullptr;
+    metadata->_blob = blob;
+    metadata->_keep_alive = std::move(keep_alive);
+    return metadata;
+}
+
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "PEView.h"
+
+namespace pkn
+{
+
+// identifies one build of an image: cheap to compute, compared before any cached metadata is used
+struct PEMetadataKey
+{
+    uint32_t timestamp;
+    uint32_t image_size;
+    uint64_t content_hash; // headers, file size and 64 evenly spaced samples of the file
+public:
+    static PEMetadataKey of(const PEView &pe) noexcept;
+    inline bool operator==(const PEMetadataKey &rhs) const noexcept
+    {
+        return timestamp == rhs.timestamp && image_size == rhs.image_size && content_hash == rhs.content_hash;
+    }
+};
+
+#pragma pack(push, 4)
+struct PEMetadataSection
+{
+    char name[8]; // not null terminated if 8 characters long
+    uint32_t virtual_address;
+    uint32_t virtual_size;
+    uint32_t raw_address;
+    uint32_t raw_size;
+    uint32_t characteristics;
+};
+
+struct PEMetadataImport
+{
+    uint32_t dll;     // string offset
+    uint32_t name;    // string offset, PEMetadata::NoString if imported by ordinal
+    uint32_t iat_rva;
+    uint16_t hint;
+    uint16_t ordinal;
+    uint8_t by_name;
+    uint8_t delayed;
+    uint8_t reserved[2];
+};
+
+struct PEMetadataExport
+{
+    uint32_t name;      // string offset, PEMetadata::NoString if exported by ordinal only
+    uint32_t forwarder; // string offset, PEMetadata::NoString if not forwarded
+    uint32_t ordinal;
+    uint32_t rva;
+};
+
+// runtime function of the exception directory(.pdata) as indexed by FunctionIndex, x64 images only
+struct PEMetadataFunction
+{
+    uint32_t begin;
+    uint32_t end;
+    uint32_t unwind;
+    uint32_t entry; // begin of the function it belongs to, chained unwind info followed
+};
+#pragma pack(pop)
+
+/*
+Everything a tool usually parses out of an image, as one position independent blob:
+header fields, sections, imports, exports and runtime functions, names in a string pool.
+A PEMetadata either owns its blob(built from a PEView) or views it in place, inside a mapped
+PEMetadataCache file, so cached metadata is used without any parsing or copying.
+Tables are arrays of the records above, in table order.
+*/
+class PEMetadata
+{
+public:
+    constexpr static uint32_t NoString = 0xFFFFFFFF;
+    constexpr static uint32_t FlagPE32Plus = 1;
+public:
+    static std::shared_ptr<PEMetadata> build(const PEView &pe);
+    // nullptr if the blob is malformed; keep_alive owns the memory of blob
+    static std::shared_ptr<PEMetadata> view(const uint8_t *blob, size_t size, std::shared_ptr<const void> keep_alive);
+public:
+    inline const uint8_t *blob() const noexcept { return _blob; }
+    inline size_t blob_size() const noexcept { return _header.size; }
+
+    inline PEMetadataKey key() const noexcept { return _header.key; }
+    inline bool is_64bit() const noexcept { return (_header.flags & FlagPE32Plus) != 0; }
+    inline uint16_t machine() const noexcept { return _header.machine; }
+    inline uint16_t subsystem() const noexcept { return _header.subsystem; }
+    inline uint16_t dll_characteristics() const noexcept { return _header.dll_characteristics; }
+    inline uint64_t image_base() const noexcept { return _header.image_base; }
+    inline uint32_t image_size() const noexcept { return _header.key.image_size; }
+    inline uint32_t entry_point_rva() const noexcept { return _header.entry_point_rva; }
+    inline uint32_t size_of_headers() const noexcept { return _header.size_of_headers; }
+    inline uint32_t checksum() const noexcept { return _header.checksum; }
+
+    inline const PEMetadataSection *sections() const noexcept { return table<PEMetadataSection>(_header.sections); }
+    inline size_t section_count() const noexcept { return _header.sections.count; }
+    inline const PEMetadataImport *imports() const noexcept { return table<PEMetadataImport>(_header.imports); }
+    inline size_t import_count() const noexcept { return _header.imports.count; }
+    inline const PEMetadataExport *exports() const noexcept { return table<PEMetadataExport>(_header.exports); }
+    inline size_t export_count() const noexcept { return _header.exports.count; }
+    inline const PEMetadataFunction *functions() const noexcept { return table<PEMetadataFunction>(_header.functions); }
+    inline size_t function_count() const noexcept { return _header.functions.count; }
+
+    // empty for NoString
+    inline std::string_view string(uint32_t offset) const noexcept
+    {
+        if (offset >= _header.strings.count)
+            return {};
+        return std::string_view((const char *)_blob + _header.strings.offset + offset);
+    }
+private:
+    struct Table
+    {
+        uint32_t offset; // from the start of the blob
+        uint32_t count;  // records, bytes for strings
+    };
+    struct BlobHeader
+    {
+        uint32_t size;
+        uint32_t flags;
+        PEMetadataKey key;
+        uint64_t image_base;
+        uint32_t entry_point_rva;
+        uint32_t size_of_headers;
+        uint32_t checksum;
+        uint16_t machine;
+        uint16_t subsystem;
+        uint16_t dll_characteristics;
+        uint16_t reserved;
+        Table sections;
+        Table imports;
+        Table exports;
+        Table functions;
+        Table strings; // null terminated strings, the last byte is 0
+    };
+    template <class T>
+    inline const T *table(const Table &t) const noexcept { return (const T *)(_blob + t.offset); }
+private:
+    BlobHeader _header = {};
+    const uint8_t *_blob = nullptr;
+    std::vector<uint8_t> _owned;
+    std::shared_ptr<const void> _keep_alive;
+};
+
+}
@@ -0,0 +1,194 @@
+#include "PEMetadataCache.h"
+#include "../base/fs/binary_file.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+namespace pkn
+{
+
+namespace
+{
+
+struct CacheFileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t count;
+    uint64_t generation;
+};
+
+struct CacheFileEntry
+{
+    PEMetadataKey key;
+    uint64_t offset;
+    uint64_t size;
+    uint64_t last_used;
+};
+
+}
+
+std::unique_ptr<PEMetadataCache> PEMetadataCache::open(const std::string &path, size_t budget)
+{
+    std::unique_ptr<PEMetadataCache> cache(new PEMetadataCache());
+    cache->_path = path;
+    cache->_budget = budget;
+    cache->load();
+    return cache;
+}
+
+void PEMetadataCache::load()
+{
+    _entries.clear();
+    _file = MappedFile::open(_path);
+    if (_file == nullptr)
+        return;
+    auto data = _file->data();
+    auto size = _file->size();
+    CacheFileHeader header;
+    if (size < sizeof(header))
+        return;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, PEMetadataCacheMagic, sizeof(header.magic)) != 0
+        || header.version != PEMetadataCacheVersion
+        || header.count > (size - sizeof(header)) / sizeof(CacheFileEntry))
+        return;
+    _generation = header.generation + 1;
+    for (uint32_t i = 0; i < header.count; i++)
+    {
+        CacheFileEntry entry;
+        memcpy(&entry, data + sizeof(header) + (size_t)i * sizeof(entry), sizeof(entry));
+        // blobs are validated when first found, only their placement is checked here
+        if (entry.offset > size || entry.size > size - entry.offset || entry.offset % 8 != 0)
+            continue;
+        _entries[entry.key] = Entry{ nullptr, entry.offset, entry.size, entry.last_used };
+    }
+}
+
+size_t PEMetadataCache::size() const
+{
+    std::lock_guard<std::mutex> l(_lock);
+    return _entries.size();
+}
+
+std::shared_ptr<const PEMetadata> PEMetadataCache::find(const PEMetadataKey &key)
+{
+    std::lock_guard<std::mutex> l(_lock);
+    auto it = _entries.find(key);
+    if (it == _entries.end())
+        return nullptr;
+    auto &entry = it->second;
+    if (entry.metadata == nullptr)
+    {
+        auto metadata = PEMetadata::view(_file->data() + entry.offset, (size_t)entry.size, _file);
+        if (metadata == nullptr || !(metadata->key() == key))
+        {
+            _entries.erase(it);
+            return nullptr;
+        }
+        entry.metadata = std::move(metadata);
+    }
+    entry.last_used = _generation;
+    return entry.metadata;
+}
+
+std::shared_ptr<const PEMetadata> PEMetadataCache::get(const PEView &pe)
+{
+    if (auto metadata = find(PEMetadataKey::of(pe)))
+        return metadata;
+    std::shared_ptr<const PEMetadata> metadata = PEMetadata::build(pe);
+    put(metadata);
+    return metadata;
+}
+
+void PEMetadataCache::put(std::shared_ptr<const PEMetadata> metadata)
+{
+    std::lock_guard<std::mutex> l(_lock);
+    auto key = metadata->key();
+    auto size = metadata->blob_size();
+    _entries[key] = Entry{ std::move(metadata), 0, size, _generation };
+}
+
+bool PEMetadataCache::save()
+{
+    std::lock_guard<std::mutex> l(_lock);
+
+    // most recently used first, within the budget
+    std::vector<std::pair<PEMetadataKey, const Entry *>> kept;
+    kept.reserve(_entries.size());
+    for (auto &p : _entries)
+        kept.emplace_back(p.first, &p.second);
+    std::sort(kept.begin(), kept.end(), [](const auto &lhs, const auto &rhs)
+              {
+                  return lhs.second->last_used > rhs.second->last_used;
+              });
+    uint64_t used = 0;
+    size_t count = 0;
+    for (; count < kept.size(); count++)
+    {
+        uint64_t size = align8(kept[count].second->size);
+        if (used + size > _budget)
+            break;
+        used += size;
+    }
+    kept.resize(count);
+
+    std::string temp_path = _path + ".tmp";
+    // not write_file_replacing(): the current file has to be unmapped before it can be replaced
+    FILE *file = open_file(temp_path, "wb");
+    if (file == nullptr)
+        return false;
+
+    CacheFileHeader header;
+    memcpy(header.magic, PEMetadataCacheMagic, sizeof(header.magic));
+    header.version = PEMetadataCacheVersion;
+    header.count = (uint32_t)kept.size();
+    header.generation = _generation;
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1;
+
+    uint64_t offset = align8(sizeof(header) + kept.size() * sizeof(CacheFileEntry));
+    for (auto &p : kept)
+    {
+        CacheFileEntry entry{ p.first, offset, p.second->size, p.second->last_used };
+        success = success && fwrite(&entry, sizeof(entry), 1, file) == 1;
+        offset += align8(entry.size);
+    }
+    static const uint8_t padding[8] = {};
+    uint64_t position = sizeof(header) + kept.size() * sizeof(CacheFileEntry);
+    for (auto &p : kept)
+    {
+        auto &entry = *p.second;
+        const uint8_t *blob = entry.metadata ? entry.metadata->blob() : _file->data() + entry.offset;
+        success = success && fwrite(padding, 1, (size_t)(align8(position) - position), file) == align8(position) - position;
+        position = align8(position);
+        success = success && fwrite(blob, 1, (size_t)entry.size, file) == entry.size;
+        position += entry.size;
+    }
+    success = fclose(file) == 0 && success;
+    if (!success)
+    {
+        remove(temp_path.c_str());
+        return false;
+    }
+
+    // the new file is mapped again, metadata already handed out keeps the old mapping alive
+    std::vector<std::shared_ptr<const PEMetadata>> added;
+    for (auto &p : _entries)
+        if (p.second.offset == 0)
+            added.push_back(std::move(p.second.metadata));
+    _entries.clear();
+    _file.reset();
+    success = replace_file(temp_path, _path);
+    load();
+    if (!success)
+    {
+        remove(temp_path.c_str());
+        for (auto &metadata : added)
+            _entries[metadata->key()] = Entry{ metadata, 0, metadata->blob_size(), _generation };
+    }
+    return success;
+}
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "../base/noncopyable.h"
+#include "../base/fs/MappedFile.h"
+#include "PEMetadata.h"
+
+namespace pkn
+{
+
+constexpr const char PEMetadataCacheMagic[8] = { 'P', 'K', 'N', 'P', 'E', 'M', 'C', '\0' };
+constexpr const uint32_t PEMetadataCacheVersion = 2;
+
+/*
+A file of PEMetadata blobs keyed by PEMetadataKey, mapped on open: a hit costs one hash lookup
+and the validation of the blob's table bounds, nothing is parsed or copied.
+Entries added with get()/put() are written by save(), which keeps the most recently used
+entries within the size budget and replaces the file atomically.
+A file of another version or a malformed file is ignored and rewritten by the next save().
+
+usage:
+@code
+auto cache = PEMetadataCache::open("pe_metadata.cache");
+for (auto &path : dlls)
+{
+    auto file = MappedFile::open(path);
+    auto pe = PEView::parse(file->data(), file->size());
+    auto metadata = cache->get(*pe); // parsed once, then loaded from the cache on later runs
+}
+cache->save();
+@endcode
+*/
+class PEMetadataCache : noncopyable
+{
+public:
+    constexpr static size_t DefaultBudget = 64 * 1024 * 1024;
+public:
+    // never nullptr, a missing or unusable file opens as an empty cache
+    static std::unique_ptr<PEMetadataCache> open(const std::string &path, size_t budget = DefaultBudget);
+public:
+    // nullptr on a miss
+    std::shared_ptr<const PEMetadata> find(const PEMetadataKey &key);
+    // from the cache, or built from pe and added to it
+    std::shared_ptr<const PEMetadata> get(const PEView &pe);
+    void put(std::shared_ptr<const PEMetadata> metadata);
+    // false if the file can not be written; on Windows the file can not be replaced
+    // while metadata viewed from it is still referenced
+    bool save();
+public:
+    inline const std::string &path() const noexcept { return _path; }
+    inline size_t budget() const noexcept { return _budget; }
+    size_t size() const;
+private:
+    PEMetadataCache() = default;
+    void load();
+private:
+    struct KeyHash
+    {
+        inline size_t operator()(const PEMetadataKey &key) const noexcept
+        {
+            return (size_t)(key.content_hash ^ ((uint64_t)key.timestamp << 32 | key.image_size));
+        }
+    };
+    struct Entry
+    {
+        std::shared_ptr<const PEMetadata> metadata; // nullptr until first found, for entries of the file
+        uint64_t offset;                            // in the file, 0 for entries added since it was loaded
+        uint64_t size;
+        uint64_t last_used;                         // generation in which the entry was last found or added
+    };
+private:
+    std::string _path;
+    size_t _budget = DefaultBudget;
+    uint64_t _generation = 1;
+    std::shared_ptr<MappedFile> _file;
+    std::unordered_map<PEMetadataKey, Entry, KeyHash> _entries;
+    mutable std::mutex _lock;
+};
+
+}
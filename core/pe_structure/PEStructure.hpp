@@ -1,10 +1,14 @@
 #pragma once
 
+#include <algorithm>
 #include <unordered_map>
 #include <vector>
 #include <functional>
 #include <random>
 #include "../memory/memory.h"
+#include "SectionMap.h"
+#include "PEMetadata.h"
+#include "Relocator.h"
 
 namespace pkn
 {
@@ -60,23 +64,18 @@ class RawPEStructure64 : PEStructure
 public:
     using PEStructure::PEStructure;
 public:
+    virtual PEView::Layout layout()
+    {
+        return PEView::Layout::File;
+    }
     virtual uint64_t rva_to_local_offset(uint64_t rva)
     {
-        auto psections = (PIMAGE_SECTION_HEADER)((uint8_t *)&pe->OptionalHeader + pe->FileHeader.SizeOfOptionalHeader);
-        if (psections->VirtualAddress > rva)
-            return rva;
-        for (int i = 0; i < pe->FileHeader.NumberOfSections; i++)
-        {
-            auto vbase = psections[i].VirtualAddress;
-            auto vsize = psections[i].Misc.VirtualSize;
-            auto raw_base = psections[i].PointerToRawData;
-            auto raw_size = psections[i].SizeOfRawData;
-            if (rva >= vbase && rva <= vbase + vsize)
-            {
-                return rva - vbase + raw_base;
-            }
-        }
-        return 0;
+        if (!section_map_built)
+            build_section_map();
+        if (rva > 0xFFFFFFFF)
+            return 0;
+        auto offset = section_map.translate((uint32_t)rva);
+        return offset == SectionMap::NoOffset ? 0 : offset;
     }
     uint64_t image_size()
     {
@@ -125,6 +124,45 @@ public:
             }
         }
     }
+    // same as parse(), from metadata of this image, usually found in a PEMetadataCache
+    // names of the imports point into metadata, which is kept alive by this object
+    void parse(std::shared_ptr<const PEMetadata> metadata)
+    {
+        for (size_t i = 0; i < metadata->section_count(); i++)
+        {
+            auto &s = metadata->sections()[i];
+            IMAGE_SECTION_HEADER section = {};
+            memcpy(section.Name, s.name, sizeof(section.Name));
+            section.Misc.VirtualSize = s.virtual_size;
+            section.VirtualAddress = s.virtual_address;
+            section.SizeOfRawData = s.raw_size;
+            section.PointerToRawData = s.raw_address;
+            section.Characteristics = s.characteristics;
+            sections.push_back(section);
+        }
+
+        for (size_t i = 0; i < metadata->import_count(); i++)
+        {
+            auto &imp = metadata->imports()[i];
+            if (imp.delayed)
+                continue;
+            ImportData data;
+            data.delayed = false;
+            data.imported_address = (uint64_t *)(base + rva_to_local_offset(imp.iat_rva));
+            data.by_name = imp.by_name != 0;
+            if (data.by_name)
+                data.u.by_name.name = metadata->string(imp.name).data();
+            else
+                data.u.by_ordinal.ordinal = imp.ordinal;
+            this->imports[std::string(metadata->string(imp.dll))].push_back(data);
+        }
+        this->metadata = std::move(metadata);
+    }
+    // the portable view of this image, to build PEMetadata from; size is the size of the buffer
+    std::optional<PEView> view(size_t size)
+    {
+        return PEView::parse(base, size, layout());
+    }
     using import_resolve_callback_t = std::function<uint64_t(const std::string &dll, const char *proc)>;
     bool resolve_imports(import_resolve_callback_t resolve)
     {
@@ -144,53 +182,24 @@ public:
         }
         return success;
     }
+    // bytes of the buffer holding this image: SizeOfImage once loaded, the end of the last raw section in a file
+    uint64_t buffer_size()
+    {
+        if (layout() == PEView::Layout::Image)
+            return image_size();
+        uint64_t end = pe->OptionalHeader.SizeOfHeaders;
+        auto psections = (PIMAGE_SECTION_HEADER)((uint8_t *)&pe->OptionalHeader + pe->FileHeader.SizeOfOptionalHeader);
+        for (int i = 0; i < pe->FileHeader.NumberOfSections; i++)
+            end = (std::max)(end, (uint64_t)psections[i].PointerToRawData + psections[i].SizeOfRawData);
+        return end;
+    }
+    // applies the base relocations for the image to run at rbase, false if any entry could not be applied
     bool relocation(uint64_t rbase)
     {
-        bool success = true;
-        uint64_t diff = rbase - pe->OptionalHeader.ImageBase;
-#pragma pack(push, 1)
-        struct IMAGE_RELOC
-        {
-            uint16_t  offset : 12;
-            uint16_t  type : 4;
-        };
-        using PIMAGE_RELOC = IMAGE_RELOC * ;
-#pragma pack(pop)
-        auto &reloc_directory = pe->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_BASERELOC];
-        //auto reloc_size = reloc_directory.Size;
-        auto relocation_block_header = (IMAGE_BASE_RELOCATION *)(base + rva_to_local_offset(reloc_directory.VirtualAddress));
-        auto whole_block_size = relocation_block_header->SizeOfBlock;
-        //auto block_base = base + rva_to_local_offset(reloc_block->VirtualAddress);
-        static_assert(sizeof(IMAGE_BASE_RELOCATION) == 8);
-        for (uint8_t *p = (uint8_t *)(relocation_block_header + 1), *e = p + whole_block_size - sizeof(IMAGE_BASE_RELOCATION);
-             p < e;
-             p += sizeof(IMAGE_RELOC))
-        {
-            PIMAGE_RELOC pr = (PIMAGE_RELOC)p;
-            switch (pr->type)
-            {
-            case IMAGE_REL_BASED_ABSOLUTE:
-                break;
-            case IMAGE_REL_BASED_HIGH:
-                *(uint16_t *)(base + rva_to_local_offset(pr->offset)) += HIWORD(diff);
-                break;
-            case IMAGE_REL_BASED_LOW:
-                *(uint16_t *)(base + rva_to_local_offset(pr->offset)) += LOWORD(diff);
-                break;
-            case IMAGE_REL_BASED_HIGHLOW:
-                *(uint32_t *)(base + rva_to_local_offset(pr->offset)) += uint32_t(diff);
-                break;
-            case IMAGE_REL_BASED_DIR64:
-                *(uint64_t *)(base + rva_to_local_offset(pr->offset)) += diff;
-                break;
-            case IMAGE_REL_BASED_HIGHADJ:
-                break;
-            default:  // unknown relocation method
-                success = false;
-                break;
-            }
-        }
-        return success;
+        auto pe_view = view(buffer_size());
+        if (!pe_view)
+            return false;
+        return relocate_image(*pe_view, base, rbase).ok();
     }
 
 
@@ -259,6 +268,25 @@ public:
     std::unordered_map<std::string, std::vector<ImportData>> imports;
     std::vector<IMAGE_SECTION_HEADER> sections;
     PIMAGE_NT_HEADERS64 pe = (PIMAGE_NT_HEADERS64)PEStructure::pe;
+private:
+    // headers up to the first section, then every section including the byte at VirtualAddress + VirtualSize
+    void build_section_map()
+    {
+        auto psections = (PIMAGE_SECTION_HEADER)((uint8_t *)&pe->OptionalHeader + pe->FileHeader.SizeOfOptionalHeader);
+        std::vector<SectionMap::Interval> intervals;
+        if (pe->FileHeader.NumberOfSections != 0)
+            intervals.push_back(SectionMap::Interval{ 0, psections->VirtualAddress, 0 });
+        for (int i = 0; i < pe->FileHeader.NumberOfSections; i++)
+        {
+            uint64_t size = (uint64_t)psections[i].Misc.VirtualSize + 1;
+            intervals.push_back(SectionMap::Interval{ psections[i].VirtualAddress, (uint32_t)(size > 0xFFFFFFFF ? 0xFFFFFFFF : size), psections[i].PointerToRawData });
+        }
+        section_map.build(intervals);
+        section_map_built = true;
+    }
+    SectionMap section_map;
+    bool section_map_built = false;
+    std::shared_ptr<const PEMetadata> metadata;
 };
 
 // used to parse a PE Image(Sections are loaded into memory)
@@ -266,6 +294,10 @@ class ImagePEStructure64 : public RawPEStructure64
 {
 public:
     using RawPEStructure64::RawPEStructure64;
+    virtual PEView::Layout layout()override
+    {
+        return PEView::Layout::Image;
+    }
     virtual uint64_t rva_to_local_offset(uint64_t rva)override
     {
         return rva;
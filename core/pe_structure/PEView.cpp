@@ -0,0 +1,251 @@
+#include "PEView.h"
+
+#include <algorithm>
+
+namespace pkn
+{
+
+std::optional<PEView> PEView::parse(const void *data, size_t size, Layout layout)
+{
+    using namespace pe_format;
+    PEView view;
+    view._data = (const uint8_t *)data;
+    view._size = size;
+    view._layout = layout;
+    if (data == nullptr || size < sizeof(DosHeader))
+        return std::nullopt;
+
+    DosHeader dos;
+    memcpy(&dos, data, sizeof(dos));
+    if (dos.e_magic != DosSignature || dos.e_lfanew < (int32_t)sizeof(dos))
+        return std::nullopt;
+    size_t nt = (size_t)dos.e_lfanew;
+    uint32_t signature;
+    if (nt > size || size - nt < sizeof(signature) + sizeof(FileHeader) + sizeof(uint16_t))
+        return std::nullopt;
+    memcpy(&signature, view._data + nt, sizeof(signature));
+    if (signature != NtSignature)
+        return std::nullopt;
+    memcpy(&view._file_header, view._data + nt + sizeof(signature), sizeof(FileHeader));
+
+    size_t optional = nt + sizeof(signature) + sizeof(FileHeader);
+    size_t optional_size = view._file_header.SizeOfOptionalHeader;
+    if (size - optional < optional_size)
+        return std::nullopt;
+    uint16_t magic;
+    memcpy(&magic, view._data + optional, sizeof(magic));
+    size_t fixed_size;
+    if (magic == OptionalHeader64Magic)
+    {
+        fixed_size = sizeof(OptionalHeader64);
+        if (optional_size < fixed_size)
+            return std::nullopt;
+        memcpy(&view._optional, view._data + optional, fixed_size);
+    }
+    else if (magic == OptionalHeader32Magic)
+    {
+        fixed_size = sizeof(OptionalHeader32);
+        if (optional_size < fixed_size)
+            return std::nullopt;
+        OptionalHeader32 header;
+        memcpy(&header, view._data + optional, fixed_size);
+        auto &o = view._optional;
+        o.Magic = header.Magic;
+        o.MajorLinkerVersion = header.MajorLinkerVersion;
+        o.MinorLinkerVersion = header.MinorLinkerVersion;
+        o.SizeOfCode = header.SizeOfCode;
+        o.SizeOfInitializedData = header.SizeOfInitializedData;
+        o.SizeOfUninitializedData = header.SizeOfUninitializedData;
+        o.AddressOfEntryPoint = header.AddressOfEntryPoint;
+        o.BaseOfCode = header.BaseOfCode;
+        o.ImageBase = header.ImageBase;
+        o.SectionAlignment = header.SectionAlignment;
+        o.FileAlignment = header.FileAlignment;
+        o.MajorOperatingSystemVersion = header.MajorOperatingSystemVersion;
+        o.MinorOperatingSystemVersion = header.MinorOperatingSystemVersion;
+        o.MajorImageVersion = header.MajorImageVersion;
+        o.MinorImageVersion = header.MinorImageVersion;
+        o.MajorSubsystemVersion = header.MajorSubsystemVersion;
+        o.MinorSubsystemVersion = header.MinorSubsystemVersion;
+        o.Win32VersionValue = header.Win32VersionValue;
+        o.SizeOfImage = header.SizeOfImage;
+        o.SizeOfHeaders = header.SizeOfHeaders;
+        o.CheckSum = header.CheckSum;
+        o.Subsystem = header.Subsystem;
+        o.DllCharacteristics = header.DllCharacteristics;
+        o.SizeOfStackReserve = header.SizeOfStackReserve;
+        o.SizeOfStackCommit = header.SizeOfStackCommit;
+        o.SizeOfHeapReserve = header.SizeOfHeapReserve;
+        o.SizeOfHeapCommit = header.SizeOfHeapCommit;
+        o.LoaderFlags = header.LoaderFlags;
+        o.NumberOfRvaAndSizes = header.NumberOfRvaAndSizes;
+    }
+    else
+    {
+        return std::nullopt;
+    }
+
+    // the directory count is bounded by both NumberOfRvaAndSizes and the room left in the optional header
+    size_t directories = (optional_size - fixed_size) / sizeof(DataDirectory);
+    directories = std::min<size_t>({ directories, view._optional.NumberOfRvaAndSizes, NumberOfDirectoryEntries });
+    view._number_of_directories = (uint32_t)directories;
+    memcpy(view._directories, view._data + optional + fixed_size, directories * sizeof(DataDirectory));
+
+    view._sections_offset = optional + optional_size;
+    size_t sections_size = (size_t)view._file_header.NumberOfSections * sizeof(SectionHeader);
+    if (size - view._sections_offset < sections_size)
+        return std::nullopt;
+    view._section_map = view.build_section_map();
+    return view;
+}
+
+std::shared_ptr<const SectionMap> PEView::build_section_map() const
+{
+    auto map = std::make_shared<SectionMap>();
+    if (_layout == Layout::Image)
+    {
+        map->build({ SectionMap::Interval{ 0, (uint32_t)std::min<size_t>(_size, 0xFFFFFFFF), 0 } });
+        return map;
+    }
+
+    std::vector<SectionMap::Interval> intervals;
+    intervals.reserve(section_count() + 1);
+    for (size_t i = 0; i < section_count(); i++)
+    {
+        auto header = section(i);
+        // the loader rounds the raw pointer down to 0x200 and maps at most VirtualSize bytes
+        size_t raw = header.PointerToRawData;
+        if (file_alignment() >= 0x200)
+            raw &= ~(size_t)0x1FF;
+        size_t raw_size = header.SizeOfRawData;
+        if (header.VirtualSize != 0)
+            raw_size = std::min<size_t>(raw_size, header.VirtualSize);
+        if (raw >= _size)
+            continue;
+        raw_size = std::min(raw_size, _size - raw);
+        intervals.push_back(SectionMap::Interval{ header.VirtualAddress, (uint32_t)raw_size, raw });
+    }
+    // headers are mapped as is, where no section covers them
+    intervals.push_back(SectionMap::Interval{ 0, (uint32_t)std::min<size_t>(size_of_headers(), _size), 0 });
+    map->build(intervals);
+    return map;
+}
+
+bool PEView::locate(uint32_t rva, size_t &offset, size_t &available) const noexcept
+{
+    if (_layout == Layout::Image)
+    {
+        if (rva >= _size)
+            return false;
+        offset = rva;
+        available = _size - rva;
+        return true;
+    }
+    uint64_t o, a;
+    if (!_section_map->locate(rva, o, a))
+        return false;
+    offset = (size_t)o;
+    available = (size_t)a;
+    return true;
+}
+
+std::optional<size_t> PEView::rva_to_offset(uint32_t rva, size_t size) const noexcept
+{
+    size_t offset, available;
+    if (!locate(rva, offset, available) || size > available)
+        return std::nullopt;
+    return offset;
+}
+
+void PEView::rva_to_offsets(const uint32_t *rvas, size_t count, uint64_t *offsets) const noexcept
+{
+    _section_map->translate(rvas, count, offsets);
+}
+
+std::string_view PEView::string_at_rva(uint32_t rva, size_t max_length) const noexcept
+{
+    size_t offset, available;
+    if (!locate(rva, offset, available))
+        return {};
+    auto p = (const char *)_data + offset;
+    auto end = (const char *)memchr(p, 0, std::min(available, max_length));
+    if (end == nullptr)
+        return {};
+    return std::string_view(p, end - p);
+}
+
+std::string_view PEView::export_name() const noexcept
+{
+    auto dir = directory(pe_format::DirectoryExport);
+    if (dir.VirtualAddress == 0)
+        return {};
+    auto exports = read_rva<pe_format::ExportDirectory>(dir.VirtualAddress);
+    if (!exports)
+        return {};
+    return string_at_rva(exports->Name);
+}
+
+std::optional<PECodeView> PEView::codeview() const noexcept
+{
+    using namespace pe_format;
+    auto dir = directory(DirectoryDebug);
+    for (uint32_t i = 0; dir.VirtualAddress != 0 && i < dir.Size / sizeof(DebugDirectory); i++)
+    {
+        auto entry = read_rva<DebugDirectory>(dir.VirtualAddress + i * (uint32_t)sizeof(DebugDirectory));
+        if (!entry)
+            break;
+        if (entry->Type != DebugTypeCodeView || entry->SizeOfData <= sizeof(CodeViewRsds))
+            continue;
+        // the data is not always mapped, files still have it at PointerToRawData
+        const uint8_t *data = entry->AddressOfRawData ? at_rva(entry->AddressOfRawData, entry->SizeOfData) : nullptr;
+        if (data == nullptr && _layout == Layout::File && entry->PointerToRawData <= _size && entry->SizeOfData <= _size - entry->PointerToRawData)
+            data = _data + entry->PointerToRawData;
+        if (data == nullptr)
+            continue;
+        CodeViewRsds rsds;
+        memcpy(&rsds, data, sizeof(rsds));
+        if (rsds.Signature != CodeViewRsdsSignature)
+            continue;
+        PECodeView codeview;
+        memcpy(codeview.guid, rsds.Guid, sizeof(codeview.guid));
+        codeview.age = rsds.Age;
+        auto path = (const char *)data + sizeof(rsds);
+        codeview.pdb_path = std::string_view(path, strnlen(path, entry->SizeOfData - sizeof(rsds)));
+        return codeview;
+    }
+    return std::nullopt;
+}
+
+std::optional<PEExportTables> PEView::export_tables() const noexcept
+{
+    auto dir = directory(pe_format::DirectoryExport);
+    if (dir.VirtualAddress == 0)
+        return std::nullopt;
+    auto exports = read_rva<pe_format::ExportDirectory>(dir.VirtualAddress);
+    if (!exports)
+        return std::nullopt;
+    PEExportTables tables;
+    tables.base = exports->Base;
+    tables.number_of_functions = exports->NumberOfFunctions;
+    tables.number_of_names = exports->NumberOfNames;
+    // counts are validated by requiring the whole table to be backed by the buffer
+    tables.functions = at_rva(exports->AddressOfFunctions, (size_t)tables.number_of_functions * 4);
+    tables.names = at_rva(exports->AddressOfNames, (size_t)tables.number_of_names * 4);
+    tables.ordinals = at_rva(exports->AddressOfNameOrdinals, (size_t)tables.number_of_names * 2);
+    if ((tables.number_of_functions != 0 && tables.functions == nullptr)
+        || (tables.number_of_names != 0 && (tables.names == nullptr || tables.ordinals == nullptr)))
+        return std::nullopt;
+    return tables;
+}
+
+PEExport PEView::export_at(const PEExportTables &tables, uint32_t index) const noexcept
+{
+    PEExport e;
+    e.rva = tables.function_rva(index);
+    e.ordinal = tables.base + index;
+    if (e.rva != 0 && in_directory(e.rva, pe_format::DirectoryExport))
+        e.forwarder = string_at_rva(e.rva, 0x200);
+    return e;
+}
+
+}
@@ -0,0 +1,304 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "PEFormat.h"
+#include "SectionMap.h"
+
+namespace pkn
+{
+
+struct PEImport
+{
+    std::string_view dll;
+    std::string_view name; // empty if imported by ordinal
+    uint16_t hint;
+    uint16_t ordinal;      // valid if !by_name
+    bool by_name;
+    bool delayed;
+    uint32_t iat_rva;      // the slot the loader writes the resolved address into
+};
+
+struct PEExport
+{
+    std::string_view name;      // empty if exported by ordinal only
+    uint32_t ordinal;           // biased by the export directory Base, as GetProcAddress takes it
+    uint32_t rva;
+    std::string_view forwarder; // "dll.function" or "dll.#ordinal" for forwarded exports, rva is then meaningless
+public:
+    inline bool forwarded() const noexcept { return !forwarder.empty(); }
+};
+
+// pdb identity from the CodeView debug directory entry
+struct PECodeView
+{
+    uint8_t guid[16];
+    uint32_t age;
+    std::string_view pdb_path;
+};
+
+// the export tables, every table lies inside the buffer
+struct PEExportTables
+{
+    uint32_t base;
+    uint32_t number_of_functions;
+    uint32_t number_of_names;
+    const uint8_t *functions; // uint32_t rva per function
+    const uint8_t *names;     // uint32_t rva per name, sorted by name
+    const uint8_t *ordinals;  // uint16_t function index per name
+public:
+    inline uint32_t function_rva(uint32_t index) const noexcept { uint32_t v; memcpy(&v, functions + (size_t)index * 4, 4); return v; }
+    inline uint32_t name_rva(uint32_t i) const noexcept { uint32_t v; memcpy(&v, names + (size_t)i * 4, 4); return v; }
+    inline uint16_t name_ordinal(uint32_t i) const noexcept { uint16_t v; memcpy(&v, ordinals + (size_t)i * 2, 2); return v; }
+};
+
+/*
+Zero copy, bounds checked view of a PE32 or PE32+ file, with no dependency on Windows headers.
+parse() only validates the headers; directories are decoded when they are walked,
+every offset, count and size read from the file is checked against the buffer,
+and names are string_views into the buffer, so the buffer must outlive the view and its results.
+
+Layout::File is a file as stored on disk(rva are translated through the section table),
+Layout::Image is a file mapped as the loader does(rva are offsets).
+
+usage:
+@code
+auto file = MappedFile::open("ntdll.dll");
+auto pe = PEView::parse(file->data(), file->size());
+if (!pe)
+    return;
+printf("%x\n", pe->entry_point_rva());
+pe->for_each_import([](const PEImport &import)
+                    {
+                        printf("%.*s!%.*s\n", (int)import.dll.size(), import.dll.data(), (int)import.name.size(), import.name.data());
+                    });
+@endcode
+*/
+class PEView
+{
+public:
+    enum class Layout
+    {
+        File,
+        Image,
+    };
+public:
+    // nullopt if the headers are malformed or truncated
+    static std::optional<PEView> parse(const void *data, size_t size, Layout layout = Layout::File);
+public:
+    inline const uint8_t *data() const noexcept { return _data; }
+    inline size_t size() const noexcept { return _size; }
+    inline Layout layout() const noexcept { return _layout; }
+
+    inline bool is_64bit() const noexcept { return _optional.Magic == pe_format::OptionalHeader64Magic; }
+    inline uint16_t machine() const noexcept { return _file_header.Machine; }
+    inline uint16_t characteristics() const noexcept { return _file_header.Characteristics; }
+    inline uint32_t timestamp() const noexcept { return _file_header.TimeDateStamp; }
+    inline uint64_t image_base() const noexcept { return _optional.ImageBase; }
+    inline uint32_t image_size() const noexcept { return _optional.SizeOfImage; }
+    inline uint32_t entry_point_rva() const noexcept { return _optional.AddressOfEntryPoint; }
+    inline uint32_t size_of_headers() const noexcept { return _optional.SizeOfHeaders; }
+    inline uint32_t section_alignment() const noexcept { return _optional.SectionAlignment; }
+    inline uint32_t file_alignment() const noexcept { return _optional.FileAlignment; }
+    inline uint32_t checksum() const noexcept { return _optional.CheckSum; }
+    inline uint16_t subsystem() const noexcept { return _optional.Subsystem; }
+    inline uint16_t dll_characteristics() const noexcept { return _optional.DllCharacteristics; }
+    // the optional header, a PE32 one widened to the PE32+ layout
+    inline const pe_format::OptionalHeader64 &optional_header() const noexcept { return _optional; }
+
+    inline size_t section_count() const noexcept { return _file_header.NumberOfSections; }
+    // the section table lies inside the buffer, checked by parse()
+    inline pe_format::SectionHeader section(size_t index) const noexcept
+    {
+        pe_format::SectionHeader header;
+        memcpy(&header, _data + _sections_offset + index * sizeof(header), sizeof(header));
+        return header;
+    }
+    // {0, 0} if the directory is absent
+    inline pe_format::DataDirectory directory(uint32_t entry) const noexcept
+    {
+        return entry < _number_of_directories ? _directories[entry] : pe_format::DataDirectory{ 0, 0 };
+    }
+    inline bool in_directory(uint32_t rva, uint32_t entry) const noexcept
+    {
+        auto dir = directory(entry);
+        return rva >= dir.VirtualAddress && rva - dir.VirtualAddress < dir.Size;
+    }
+public:
+    // [offset, offset + available) is the contiguous run of the buffer backing rva
+    bool locate(uint32_t rva, size_t &offset, size_t &available) const noexcept;
+    // offset in the buffer of [rva, rva + size), nullopt unless all of it is backed by the buffer
+    std::optional<size_t> rva_to_offset(uint32_t rva, size_t size = 1) const noexcept;
+    // offsets[i] = offset of rvas[i], SectionMap::NoOffset if it is not backed by the buffer
+    void rva_to_offsets(const uint32_t *rvas, size_t count, uint64_t *offsets) const noexcept;
+    // translation table of a Layout::File view, built by parse() and shared by copies of the view
+    inline const SectionMap &section_map() const noexcept { return *_section_map; }
+    // nullptr unless [rva, rva + size) is backed by the buffer
+    inline const uint8_t *at_rva(uint32_t rva, size_t size) const noexcept
+    {
+        auto offset = rva_to_offset(rva, size);
+        return offset ? _data + *offset : nullptr;
+    }
+    // unaligned safe
+    template <class T>
+    inline std::optional<T> read_rva(uint32_t rva) const noexcept
+    {
+        auto p = at_rva(rva, sizeof(T));
+        if (p == nullptr)
+            return std::nullopt;
+        T value;
+        memcpy(&value, p, sizeof(T));
+        return value;
+    }
+    // null terminated string at rva, empty if unmapped or not terminated within max_length
+    std::string_view string_at_rva(uint32_t rva, size_t max_length = 0x1000) const noexcept;
+public:
+    /*
+    f(const PEImport &) for every import, delay loaded ones included, in table order.
+    false if a table is malformed, imports visited before the error are still reported.
+    */
+    template <class F>
+    bool for_each_import(F f) const
+    {
+        bool ok = true;
+        auto dir = directory(pe_format::DirectoryImport);
+        for (uint32_t rva = dir.VirtualAddress; dir.VirtualAddress != 0 && rva >= dir.VirtualAddress; rva += sizeof(pe_format::ImportDescriptor))
+        {
+            auto descriptor = read_rva<pe_format::ImportDescriptor>(rva);
+            if (!descriptor)
+            {
+                ok = false;
+                break;
+            }
+            if (descriptor->Name == 0 && descriptor->FirstThunk == 0)
+                break;
+            uint32_t lookup = descriptor->OriginalFirstThunk ? descriptor->OriginalFirstThunk : descriptor->FirstThunk;
+            ok &= walk_thunks(descriptor->Name, lookup, descriptor->FirstThunk, false, f);
+        }
+        dir = directory(pe_format::DirectoryDelayImport);
+        for (uint32_t rva = dir.VirtualAddress; dir.VirtualAddress != 0 && rva >= dir.VirtualAddress; rva += sizeof(pe_format::DelayImportDescriptor))
+        {
+            auto descriptor = read_rva<pe_format::DelayImportDescriptor>(rva);
+            if (!descriptor)
+            {
+                ok = false;
+                break;
+            }
+            if (descriptor->DllNameRVA == 0)
+                break;
+            // descriptors of old linkers hold virtual addresses, attribute bit 0 marks rva based ones
+            uint32_t bias = (descriptor->Attributes & 1) ? 0 : (uint32_t)image_base();
+            ok &= walk_thunks(descriptor->DllNameRVA - bias, descriptor->ImportNameTableRVA - bias, descriptor->ImportAddressTableRVA - bias, true, f);
+        }
+        return ok;
+    }
+
+    // name of the dll in the export directory, empty if none
+    std::string_view export_name() const noexcept;
+    // the first RSDS CodeView entry of the debug directory, nullopt if none
+    std::optional<PECodeView> codeview() const noexcept;
+    // nullopt if there is no export directory or it is malformed
+    std::optional<PEExportTables> export_tables() const noexcept;
+    // export of function index(ordinal - base) of the tables, without its name
+    PEExport export_at(const PEExportTables &tables, uint32_t index) const noexcept;
+    /*
+    f(const PEExport &) for every export: named ones in name order first, then the ordinal only ones.
+    false if the export directory is malformed.
+    */
+    template <class F>
+    bool for_each_export(F f) const
+    {
+        auto tables = export_tables();
+        if (!tables)
+            return directory(pe_format::DirectoryExport).VirtualAddress == 0;
+        std::vector<bool> named(tables->number_of_functions);
+        for (uint32_t i = 0; i < tables->number_of_names; i++)
+        {
+            uint16_t index = tables->name_ordinal(i);
+            if (index >= tables->number_of_functions)
+                return false;
+            PEExport e = export_at(*tables, index);
+            e.name = string_at_rva(tables->name_rva(i));
+            if (e.name.empty())
+                return false;
+            named[index] = true;
+            f(e);
+        }
+        for (uint32_t index = 0; index < tables->number_of_functions; index++)
+        {
+            if (named[index])
+                continue;
+            PEExport e = export_at(*tables, index);
+            if (e.rva != 0)
+                f(e);
+        }
+        return true;
+    }
+private:
+    PEView() = default;
+    std::shared_ptr<const SectionMap> build_section_map() const;
+
+    template <class F>
+    bool walk_thunks(uint32_t dll_name_rva, uint32_t lookup_rva, uint32_t iat_rva, bool delayed, F &f) const
+    {
+        auto dll = string_at_rva(dll_name_rva);
+        if (dll.empty() || lookup_rva == 0)
+            return false;
+        const uint32_t thunk_size = is_64bit() ? 8 : 4;
+        const uint64_t ordinal_flag = is_64bit() ? pe_format::OrdinalFlag64 : pe_format::OrdinalFlag32;
+        for (uint32_t i = 0;; i++)
+        {
+            uint64_t thunk = 0;
+            if ((uint64_t)i * thunk_size > 0xFFFFFFFFull - lookup_rva)
+                return false;
+            auto p = at_rva(lookup_rva + i * thunk_size, thunk_size);
+            if (p == nullptr)
+                return false;
+            memcpy(&thunk, p, thunk_size);
+            if (thunk == 0)
+                return true;
+            PEImport import;
+            import.dll = dll;
+            import.delayed = delayed;
+            import.iat_rva = iat_rva + i * thunk_size;
+            import.hint = 0;
+            import.ordinal = 0;
+            if (thunk & ordinal_flag)
+            {
+                import.by_name = false;
+                import.ordinal = (uint16_t)thunk;
+            }
+            else
+            {
+                // IMAGE_IMPORT_BY_NAME: hint, then the name
+                if (thunk > 0xFFFFFFFFull - 2)
+                    return false;
+                auto hint = read_rva<uint16_t>((uint32_t)thunk);
+                import.name = string_at_rva((uint32_t)thunk + 2);
+                if (!hint || import.name.empty())
+                    return false;
+                import.by_name = true;
+                import.hint = *hint;
+            }
+            f(import);
+        }
+    }
+
+private:
+    const uint8_t *_data = nullptr;
+    size_t _size = 0;
+    Layout _layout = Layout::File;
+    pe_format::FileHeader _file_header = {};
+    pe_format::OptionalHeader64 _optional = {};
+    pe_format::DataDirectory _directories[pe_format::NumberOfDirectoryEntries] = {};
+    uint32_t _number_of_directories = 0;
+    size_t _sections_offset = 0;
+    std::shared_ptr<const SectionMap> _section_map;
+};
+
+}
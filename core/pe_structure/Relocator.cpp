@@ -0,0 +1,204 @@
+#include "Relocator.h"
+
+#include <algorithm>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define PKN_RELOCATOR_SSE2
+#endif
+
+namespace pkn
+{
+
+namespace
+{
+
+template <class T>
+inline void add_to(uint8_t *p, T delta) noexcept
+{
+    T value;
+    memcpy(&value, p, sizeof(T));
+    value += delta;
+    memcpy(p, &value, sizeof(T));
+}
+
+// all eight entries are DIR64, their offsets are returned
+inline bool all_dir64(const uint8_t *entries, uint16_t offsets[8]) noexcept
+{
+#ifdef PKN_RELOCATOR_SSE2
+    auto v = _mm_loadu_si128((const __m128i *)entries);
+    auto types = _mm_and_si128(v, _mm_set1_epi16((short)0xF000));
+    auto dir64 = _mm_cmpeq_epi16(types, _mm_set1_epi16((short)(RelocationDir64 << 12)));
+    if (_mm_movemask_epi8(dir64) != 0xFFFF)
+        return false;
+    _mm_storeu_si128((__m128i *)offsets, _mm_and_si128(v, _mm_set1_epi16(0x0FFF)));
+    return true;
+#else
+    uint16_t raw[8];
+    memcpy(raw, entries, sizeof(raw));
+    for (int i = 0; i < 8; i++)
+    {
+        if ((raw[i] >> 12) != RelocationDir64)
+            return false;
+        offsets[i] = raw[i] & 0x0FFF;
+    }
+    return true;
+#endif
+}
+
+struct BlockContext
+{
+    const PEView &pe;
+    uint8_t *image;
+    uint64_t delta;
+    uint32_t block_rva;
+    uint8_t *page;      // image bytes of block_rva, nullptr if the page is not backed
+    size_t page_bytes;  // bytes backed from page, at most a page and the width of the widest entry
+    RelocationResult &result;
+public:
+    // bytes of [rva, rva + width), or nullptr after reporting why
+    uint8_t *target(uint32_t offset, uint32_t width, uint32_t entry_index, uint16_t type)
+    {
+        uint64_t rva = (uint64_t)block_rva + offset;
+        if (rva + width <= pe.image_size())
+        {
+            if (page != nullptr && offset + width <= page_bytes)
+                return page + offset;
+            // the page straddles the end of a section's raw data
+            if (auto o = pe.rva_to_offset((uint32_t)rva, width))
+                return image + *o;
+        }
+        result.errors.push_back(RelocationError{ RelocationErrorKind::OutOfImage, block_rva, entry_index, (uint32_t)rva, type });
+        return nullptr;
+    }
+};
+
+void apply_block(BlockContext &block, const uint8_t *entries, uint32_t count)
+{
+    auto &result = block.result;
+    uint32_t i = 0;
+    while (i < count)
+    {
+        uint16_t offsets[8];
+        if (count - i >= 8 && all_dir64(entries + i * 2, offsets))
+        {
+            uint16_t highest = *std::max_element(offsets, offsets + 8);
+            if (block.page != nullptr && highest + 8u <= block.page_bytes && (uint64_t)block.block_rva + highest + 8 <= block.pe.image_size())
+            {
+                for (int k = 0; k < 8; k++)
+                    add_to<uint64_t>(block.page + offsets[k], block.delta);
+                result.applied += 8;
+                i += 8;
+                continue;
+            }
+        }
+
+        uint16_t entry;
+        memcpy(&entry, entries + i * 2, sizeof(entry));
+        uint16_t type = entry >> 12;
+        uint32_t offset = entry & 0x0FFF;
+        uint8_t *p;
+        switch (type)
+        {
+        case RelocationAbsolute:
+            break;
+        case RelocationHigh:
+            if ((p = block.target(offset, 2, i, type)) != nullptr)
+            {
+                add_to<uint16_t>(p, (uint16_t)(block.delta >> 16));
+                result.applied++;
+            }
+            break;
+        case RelocationLow:
+            if ((p = block.target(offset, 2, i, type)) != nullptr)
+            {
+                add_to<uint16_t>(p, (uint16_t)block.delta);
+                result.applied++;
+            }
+            break;
+        case RelocationHighLow:
+            if ((p = block.target(offset, 4, i, type)) != nullptr)
+            {
+                add_to<uint32_t>(p, (uint32_t)block.delta);
+                result.applied++;
+            }
+            break;
+        case RelocationHighAdj:
+            // the next entry holds the low 16 bits of the 32 bits value
+            if (i + 1 >= count)
+            {
+                result.errors.push_back(RelocationError{ RelocationErrorKind::MalformedBlock, block.block_rva, i, block.block_rva + offset, type });
+                break;
+            }
+            if ((p = block.target(offset, 2, i, type)) != nullptr)
+            {
+                uint16_t high, low;
+                memcpy(&high, p, sizeof(high));
+                memcpy(&low, entries + (i + 1) * 2, sizeof(low));
+                uint32_t value = ((uint32_t)high << 16) + (uint32_t)(int32_t)(int16_t)low + (uint32_t)block.delta;
+                high = (uint16_t)((value + 0x8000) >> 16);
+                memcpy(p, &high, sizeof(high));
+                result.applied++;
+            }
+            i++;
+            break;
+        case RelocationDir64:
+            if ((p = block.target(offset, 8, i, type)) != nullptr)
+            {
+                add_to<uint64_t>(p, block.delta);
+                result.applied++;
+            }
+            break;
+        default:
+            result.errors.push_back(RelocationError{ RelocationErrorKind::UnsupportedType, block.block_rva, i, block.block_rva + offset, type });
+            break;
+        }
+        i++;
+    }
+}
+
+}
+
+RelocationResult relocate_image(const PEView &pe, uint8_t *image, uint64_t new_base)
+{
+    RelocationResult result;
+    uint64_t delta = new_base - pe.image_base();
+    auto dir = pe.directory(pe_format::DirectoryBaseReloc);
+    if (delta == 0 || dir.VirtualAddress == 0 || dir.Size == 0)
+        return result;
+
+    constexpr uint32_t PageSize = 0x1000;
+    constexpr uint32_t WidestEntry = 8;
+    uint32_t position = 0;
+    while (dir.Size - position >= sizeof(pe_format::BaseRelocation))
+    {
+        uint32_t header_rva = dir.VirtualAddress + position;
+        auto header = pe.read_rva<pe_format::BaseRelocation>(header_rva);
+        if (!header || header->SizeOfBlock < sizeof(pe_format::BaseRelocation) || header->SizeOfBlock > dir.Size - position || header->SizeOfBlock % 2 != 0)
+        {
+            result.errors.push_back(RelocationError{ RelocationErrorKind::MalformedBlock, header ? header->VirtualAddress : 0, 0, header_rva, 0 });
+            break;
+        }
+        uint32_t count = (header->SizeOfBlock - sizeof(pe_format::BaseRelocation)) / 2;
+        auto entries = pe.at_rva(header_rva + sizeof(pe_format::BaseRelocation), (size_t)count * 2);
+        if (entries == nullptr)
+        {
+            result.errors.push_back(RelocationError{ RelocationErrorKind::MalformedBlock, header->VirtualAddress, 0, header_rva, 0 });
+            break;
+        }
+
+        BlockContext block{ pe, image, delta, header->VirtualAddress, nullptr, 0, result };
+        size_t offset, available;
+        if (pe.locate(header->VirtualAddress, offset, available))
+        {
+            block.page = image + offset;
+            block.page_bytes = std::min<size_t>(available, PageSize + WidestEntry);
+        }
+        apply_block(block, entries, count);
+        result.blocks++;
+        position += header->SizeOfBlock;
+    }
+    return result;
+}
+
+}
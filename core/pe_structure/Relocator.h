@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "PEView.h"
+
+namespace pkn
+{
+
+enum RelocationType : uint16_t
+{
+    RelocationAbsolute = 0,
+    RelocationHigh = 1,
+    RelocationLow = 2,
+    RelocationHighLow = 3,
+    RelocationHighAdj = 4,
+    RelocationDir64 = 10,
+};
+
+enum class RelocationErrorKind
+{
+    MalformedBlock,  // block header out of the directory or with an invalid size, the walk stops there
+    OutOfImage,      // the patched bytes are outside the image or the buffer
+    UnsupportedType,
+};
+
+struct RelocationError
+{
+    RelocationErrorKind kind;
+    uint32_t block_rva;   // page of the block
+    uint32_t entry_index; // in the block
+    uint32_t rva;         // patched address
+    uint16_t type;
+};
+
+struct RelocationResult
+{
+    size_t blocks = 0;
+    size_t applied = 0;
+    std::vector<RelocationError> errors;
+public:
+    inline bool ok() const noexcept { return errors.empty(); }
+};
+
+/*
+Applies every base relocation block of pe to image, the buffer pe views, for the image to run at new_base.
+Works on both layouts, blocks and entries are validated against SizeOfImage and the buffer,
+and entries that are not applied are reported one by one.
+Runs of DIR64 entries are classified eight at a time and patched without per entry dispatch.
+
+usage:
+@code
+std::vector<uint8_t> image = load_sections(file);
+auto pe = PEView::parse(image.data(), image.size(), PEView::Layout::Image);
+auto result = relocate_image(*pe, image.data(), new_base);
+for (auto &error : result.errors)
+    printf("block %x entry %u type %u\n", error.block_rva, error.entry_index, error.type);
+@endcode
+*/
+RelocationResult relocate_image(const PEView &pe, uint8_t *image, uint64_t new_base);
+
+}
@@ -0,0 +1,348 @@
+#include "RemotePEImage.h"
+
+#include <string.h>
+#include <algorithm>
+
+#include "../reader/BatchReader.h"
+
+namespace pkn
+{
+
+namespace
+{
+
+// headers larger than this are not read, no linker emits them
+constexpr size_t MaxHeadersSize = 0x10000;
+
+}
+
+std::unique_ptr<RemotePEImage> RemotePEImage::open(const IProcessReader &reader, rptr_t base)
+{
+    std::unique_ptr<RemotePEImage> image(new RemotePEImage(reader, base));
+    auto &bytes = image->_header_bytes;
+    bytes.resize(PageSize);
+    if (!reader.read_unsafe(base, bytes.size(), bytes.data()))
+        return nullptr;
+    auto headers = PEView::parse(bytes.data(), bytes.size(), PEView::Layout::Image);
+    if (!headers)
+        return nullptr;
+    if (headers->size_of_headers() > PageSize && headers->size_of_headers() <= MaxHeadersSize)
+    {
+        bytes.resize((headers->size_of_headers() + PageSize - 1) & ~(size_t)(PageSize - 1));
+        if (!reader.read_unsafe(base, bytes.size(), bytes.data()))
+            return nullptr;
+        headers = PEView::parse(bytes.data(), bytes.size(), PEView::Layout::Image);
+        if (!headers)
+            return nullptr;
+    }
+    image->_headers = std::move(headers);
+    image->clear();
+    return image;
+}
+
+void RemotePEImage::clear()
+{
+    std::lock_guard<std::mutex> l(_lock);
+    _pages.clear();
+    // the pages of the headers are already here
+    for (uint32_t page = 0; (size_t)(page + 1) * PageSize <= _header_bytes.size(); page++)
+    {
+        auto bytes = std::make_unique<uint8_t[]>(PageSize);
+        memcpy(bytes.get(), _header_bytes.data() + (size_t)page * PageSize, PageSize);
+        _pages.emplace(page, std::move(bytes));
+    }
+}
+
+size_t RemotePEImage::bytes_read() const
+{
+    std::lock_guard<std::mutex> l(_lock);
+    return _bytes_read;
+}
+
+bool RemotePEImage::prefetch(const RvaRange *ranges, size_t count)
+{
+    std::vector<uint32_t> pages;
+    bool readable = true;
+    for (size_t i = 0; i < count; i++)
+    {
+        auto &range = ranges[i];
+        if (range.size == 0)
+            continue;
+        if ((uint64_t)range.rva + range.size > image_size())
+        {
+            readable = false;
+            continue;
+        }
+        for (uint32_t page = range.rva / PageSize; page <= (range.rva + range.size - 1) / PageSize; page++)
+            pages.push_back(page);
+    }
+    std::sort(pages.begin(), pages.end());
+    pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+    std::lock_guard<std::mutex> l(_lock);
+    std::vector<uint32_t> missing;
+    for (auto page : pages)
+    {
+        auto it = _pages.find(page);
+        if (it == _pages.end())
+            missing.push_back(page);
+        else if (it->second == nullptr)
+            readable = false;
+    }
+    if (missing.empty())
+        return readable;
+
+    std::vector<std::unique_ptr<uint8_t[]>> buffers(missing.size());
+    std::vector<ReadRequest> requests(missing.size());
+    for (size_t i = 0; i < missing.size(); i++)
+    {
+        buffers[i] = std::make_unique<uint8_t[]>(PageSize);
+        requests[i] = ReadRequest{ _base + (rptr_t)missing[i] * PageSize, PageSize, buffers[i].get(), false };
+    }
+    read_coalesced(_reader, requests);
+    for (size_t i = 0; i < missing.size(); i++)
+    {
+        if (requests[i].success)
+        {
+            _bytes_read += PageSize;
+            _pages.emplace(missing[i], std::move(buffers[i]));
+        }
+        else
+        {
+            readable = false;
+            _pages.emplace(missing[i], nullptr);
+        }
+    }
+    return readable;
+}
+
+bool RemotePEImage::prefetch_directory(uint32_t entry)
+{
+    auto dir = _headers->directory(entry);
+    if (dir.VirtualAddress == 0 || dir.Size == 0)
+        return true;
+    RvaRange range{ dir.VirtualAddress, dir.Size };
+    return prefetch(&range, 1);
+}
+
+bool RemotePEImage::copy_cached(uint32_t rva, size_t size, void *buffer) const
+{
+    auto out = (uint8_t *)buffer;
+    while (size != 0)
+    {
+        auto it = _pages.find(rva / PageSize);
+        if (it == _pages.end() || it->second == nullptr)
+            return false;
+        size_t offset = rva % PageSize;
+        size_t n = std::min<size_t>(size, PageSize - offset);
+        memcpy(out, it->second.get() + offset, n);
+        out += n;
+        rva += (uint32_t)n;
+        size -= n;
+    }
+    return true;
+}
+
+bool RemotePEImage::read(uint32_t rva, size_t size, void *buffer)
+{
+    if (size == 0)
+        return true;
+    if ((uint64_t)rva + size > image_size())
+        return false;
+    RvaRange range{ rva, (uint32_t)size };
+    if (!prefetch(&range, 1))
+        return false;
+    std::lock_guard<std::mutex> l(_lock);
+    return copy_cached(rva, size, buffer);
+}
+
+std::string RemotePEImage::string_at(uint32_t rva, size_t max_length)
+{
+    std::string s;
+    uint64_t position = rva;
+    while (s.size() < max_length && position < image_size())
+    {
+        RvaRange range{ (uint32_t)position, 1 };
+        if (!prefetch(&range, 1))
+            return {};
+        std::lock_guard<std::mutex> l(_lock);
+        auto it = _pages.find((uint32_t)(position / PageSize));
+        if (it == _pages.end() || it->second == nullptr)
+            return {};
+        size_t offset = (size_t)(position % PageSize);
+        size_t n = std::min<size_t>(PageSize - offset, max_length - s.size());
+        auto begin = (const char *)it->second.get() + offset;
+        if (auto end = (const char *)memchr(begin, 0, n))
+        {
+            s.append(begin, end);
+            return s;
+        }
+        s.append(begin, n);
+        position += n;
+    }
+    return {};
+}
+
+const RemotePEImage::ExportDirectory *RemotePEImage::export_directory()
+{
+    std::call_once(_exports_once, [this]()
+                   {
+                       auto dir = _headers->directory(pe_format::DirectoryExport);
+                       if (dir.VirtualAddress == 0)
+                           return;
+                       auto exports = read<pe_format::ExportDirectory>(dir.VirtualAddress);
+                       if (!exports)
+                           return;
+                       // tables must lie inside the image, their pages are fetched as lookups touch them
+                       auto inside = [&](uint32_t rva, uint64_t size)
+                       {
+                           return (uint64_t)rva + size <= image_size();
+                       };
+                       if (!inside(exports->AddressOfFunctions, (uint64_t)exports->NumberOfFunctions * 4)
+                           || !inside(exports->AddressOfNames, (uint64_t)exports->NumberOfNames * 4)
+                           || !inside(exports->AddressOfNameOrdinals, (uint64_t)exports->NumberOfNames * 2))
+                           return;
+                       _exports = ExportDirectory{ exports->Base, exports->NumberOfFunctions, exports->NumberOfNames,
+                           exports->AddressOfFunctions, exports->AddressOfNames, exports->AddressOfNameOrdinals };
+                   });
+    return _exports ? &*_exports : nullptr;
+}
+
+std::optional<RemoteExport> RemotePEImage::export_at(const ExportDirectory &exports, uint32_t index)
+{
+    if (index >= exports.number_of_functions)
+        return std::nullopt;
+    auto rva = read<uint32_t>(exports.functions + index * 4);
+    if (!rva || *rva == 0)
+        return std::nullopt;
+    RemoteExport e;
+    e.ordinal = exports.base + index;
+    e.rva = *rva;
+    e.address = _base + *rva;
+    if (_headers->in_directory(*rva, pe_format::DirectoryExport))
+    {
+        e.forwarder = string_at(*rva, 0x200);
+        e.address = 0;
+    }
+    return e;
+}
+
+std::optional<RemoteExport> RemotePEImage::find_export(std::string_view name)
+{
+    std::optional<RemoteExport> result;
+    find_exports(&name, 1, &result);
+    return result;
+}
+
+std::optional<RemoteExport> RemotePEImage::find_export(uint32_t ordinal)
+{
+    auto exports = export_directory();
+    if (exports == nullptr || ordinal < exports->base)
+        return std::nullopt;
+    return export_at(*exports, ordinal - exports->base);
+}
+
+bool RemotePEImage::find_exports(const std::string_view *names, size_t count, std::optional<RemoteExport> *results)
+{
+    for (size_t i = 0; i < count; i++)
+        results[i].reset();
+    auto exports = export_directory();
+    if (exports == nullptr)
+        return count == 0;
+
+    // the binary searches over the sorted name table advance together, one batch of reads per step
+    struct Search
+    {
+        uint32_t low;
+        uint32_t high;
+        uint32_t middle;
+        uint32_t name_rva;
+        int64_t found;
+    };
+    std::vector<Search> searches(count, Search{ 0, exports->number_of_names, 0, 0, -1 });
+    std::vector<RvaRange> ranges;
+    std::vector<char> name;
+    for (;;)
+    {
+        ranges.clear();
+        for (auto &s : searches)
+        {
+            if (s.found >= 0 || s.low >= s.high)
+                continue;
+            s.middle = s.low + (s.high - s.low) / 2;
+            ranges.push_back(RvaRange{ exports->names + s.middle * 4, 4 });
+        }
+        if (ranges.empty())
+            break;
+        prefetch(ranges.data(), ranges.size());
+
+        // only as many bytes of a name as the comparison needs
+        ranges.clear();
+        for (size_t i = 0; i < count; i++)
+        {
+            auto &s = searches[i];
+            if (s.found >= 0 || s.low >= s.high)
+                continue;
+            auto name_rva = read<uint32_t>(exports->names + s.middle * 4);
+            if (!name_rva || *name_rva >= image_size())
+            {
+                s.high = s.low;
+                continue;
+            }
+            s.name_rva = *name_rva;
+            ranges.push_back(RvaRange{ s.name_rva, (uint32_t)std::min<uint64_t>(names[i].size() + 1, image_size() - s.name_rva) });
+        }
+        prefetch(ranges.data(), ranges.size());
+
+        for (size_t i = 0; i < count; i++)
+        {
+            auto &s = searches[i];
+            if (s.found >= 0 || s.low >= s.high)
+                continue;
+            name.resize((size_t)std::min<uint64_t>(names[i].size() + 1, image_size() - s.name_rva));
+            if (!read(s.name_rva, name.size(), name.data()))
+            {
+                s.high = s.low;
+                continue;
+            }
+            std::string_view candidate(name.data(), strnlen(name.data(), name.size()));
+            int order = candidate.compare(names[i]);
+            if (order == 0)
+                s.found = s.middle;
+            else if (order < 0)
+                s.low = s.middle + 1;
+            else
+                s.high = s.middle;
+        }
+    }
+
+    ranges.clear();
+    for (auto &s : searches)
+        if (s.found >= 0)
+            ranges.push_back(RvaRange{ exports->ordinals + (uint32_t)s.found * 2, 2 });
+    prefetch(ranges.data(), ranges.size());
+    ranges.clear();
+    std::vector<int64_t> indexes(count, -1);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (searches[i].found < 0)
+            continue;
+        if (auto index = read<uint16_t>(exports->ordinals + (uint32_t)searches[i].found * 2))
+        {
+            indexes[i] = *index;
+            ranges.push_back(RvaRange{ exports->functions + *index * 4u, 4 });
+        }
+    }
+    prefetch(ranges.data(), ranges.size());
+
+    bool all_found = true;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (indexes[i] >= 0)
+            results[i] = export_at(*exports, (uint32_t)indexes[i]);
+        all_found = all_found && results[i].has_value();
+    }
+    return all_found;
+}
+
+}
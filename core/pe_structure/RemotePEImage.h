@@ -0,0 +1,201 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../base/types.h"
+#include "../base/noncopyable.h"
+#include "../remote_process/IProcess.h"
+#include "PEView.h"
+
+namespace pkn
+{
+
+struct RvaRange
+{
+    uint32_t rva;
+    uint32_t size;
+};
+
+struct RemoteExport
+{
+    uint32_t ordinal;      // biased by the export directory Base
+    uint32_t rva;
+    rptr_t address;        // base + rva, 0 for forwarded exports
+    std::string forwarder; // "dll.function" or "dll.#ordinal" for forwarded exports
+public:
+    inline bool forwarded() const noexcept { return !forwarder.empty(); }
+};
+
+/*
+A PE image mapped in another process, read piece by piece through an IProcessReader.
+The headers are read once by open(), everything else is fetched on demand one page at a time
+and cached, so walking the exports of a module reads the few pages the lookups touch
+instead of the whole image. Lookups of several exports are done in lockstep, each step of
+their binary searches is one batch of coalesced reads.
+
+usage:
+@code
+auto ntdll = RemotePEImage::open(process, ntdll_base);
+std::string_view names[] = { "NtOpenProcess", "NtReadVirtualMemory" };
+std::optional<RemoteExport> exports[2];
+ntdll->find_exports(names, 2, exports);
+printf("%zu bytes read\n", ntdll->bytes_read());
+@endcode
+*/
+class RemotePEImage : noncopyable
+{
+public:
+    constexpr static uint32_t PageSize = 0x1000;
+public:
+    // nullptr if the headers can not be read or are not a PE image; reader must outlive the image
+    static std::unique_ptr<RemotePEImage> open(const IProcessReader &reader, rptr_t base);
+public:
+    inline rptr_t base() const noexcept { return _base; }
+    // view of the headers only: fields, sections and directories; rva outside the headers are not readable from it
+    inline const PEView &headers() const noexcept { return *_headers; }
+    inline uint32_t image_size() const noexcept { return _headers->image_size(); }
+
+    // fetches every page of ranges not cached yet with one coalesced batch, false if some could not be read
+    bool prefetch(const RvaRange *ranges, size_t count);
+    bool prefetch_directory(uint32_t entry);
+    // false if [rva, rva + size) is not entirely readable
+    bool read(uint32_t rva, size_t size, void *buffer);
+    template <class T>
+    inline std::optional<T> read(uint32_t rva)
+    {
+        T value;
+        if (!read(rva, sizeof(T), &value))
+            return std::nullopt;
+        return value;
+    }
+    // null terminated string at rva, empty if unreadable or not terminated within max_length
+    std::string string_at(uint32_t rva, size_t max_length = 0x1000);
+
+    // bytes fetched from the process so far
+    size_t bytes_read() const;
+    // drops every cached page, the headers are kept
+    void clear();
+public:
+    // nullopt if not exported or the export directory is malformed
+    std::optional<RemoteExport> find_export(std::string_view name);
+    std::optional<RemoteExport> find_export(uint32_t ordinal);
+    // results[i] for names[i]; false if any of them is not found
+    bool find_exports(const std::string_view *names, size_t count, std::optional<RemoteExport> *results);
+
+    /*
+    f(const PEImport &) for every import, delay loaded ones included, in table order;
+    strings of the import are valid during the call only.
+    false if a table is malformed or unreadable.
+    */
+    template <class F>
+    bool for_each_import(F f)
+    {
+        bool ok = prefetch_directory(pe_format::DirectoryImport) && prefetch_directory(pe_format::DirectoryDelayImport);
+        auto dir = _headers->directory(pe_format::DirectoryImport);
+        for (uint32_t rva = dir.VirtualAddress; dir.VirtualAddress != 0 && rva >= dir.VirtualAddress; rva += sizeof(pe_format::ImportDescriptor))
+        {
+            auto descriptor = read<pe_format::ImportDescriptor>(rva);
+            if (!descriptor)
+                return false;
+            if (descriptor->Name == 0 && descriptor->FirstThunk == 0)
+                break;
+            uint32_t lookup = descriptor->OriginalFirstThunk ? descriptor->OriginalFirstThunk : descriptor->FirstThunk;
+            ok &= walk_thunks(descriptor->Name, lookup, descriptor->FirstThunk, false, f);
+        }
+        dir = _headers->directory(pe_format::DirectoryDelayImport);
+        for (uint32_t rva = dir.VirtualAddress; dir.VirtualAddress != 0 && rva >= dir.VirtualAddress; rva += sizeof(pe_format::DelayImportDescriptor))
+        {
+            auto descriptor = read<pe_format::DelayImportDescriptor>(rva);
+            if (!descriptor)
+                return false;
+            if (descriptor->DllNameRVA == 0)
+                break;
+            uint32_t bias = (descriptor->Attributes & 1) ? 0 : (uint32_t)_headers->image_base();
+            ok &= walk_thunks(descriptor->DllNameRVA - bias, descriptor->ImportNameTableRVA - bias, descriptor->ImportAddressTableRVA - bias, true, f);
+        }
+        return ok;
+    }
+private:
+    RemotePEImage(const IProcessReader &reader, rptr_t base) : _reader(reader), _base(base) {}
+    struct ExportDirectory
+    {
+        uint32_t base;
+        uint32_t number_of_functions;
+        uint32_t number_of_names;
+        uint32_t functions;
+        uint32_t names;
+        uint32_t ordinals;
+    };
+    const ExportDirectory *export_directory();
+    std::optional<RemoteExport> export_at(const ExportDirectory &exports, uint32_t index);
+    // copies [rva, rva + size) from cached pages, false if a page is missing or unreadable
+    bool copy_cached(uint32_t rva, size_t size, void *buffer) const;
+
+    template <class F>
+    bool walk_thunks(uint32_t dll_name_rva, uint32_t lookup_rva, uint32_t iat_rva, bool delayed, F &f)
+    {
+        auto dll = string_at(dll_name_rva);
+        if (dll.empty() || lookup_rva == 0)
+            return false;
+        const uint32_t thunk_size = _headers->is_64bit() ? 8 : 4;
+        const uint64_t ordinal_flag = _headers->is_64bit() ? pe_format::OrdinalFlag64 : pe_format::OrdinalFlag32;
+        for (uint32_t i = 0;; i++)
+        {
+            uint64_t thunk = 0;
+            if ((uint64_t)i * thunk_size > 0xFFFFFFFFull - lookup_rva)
+                return false;
+            if (!read(lookup_rva + i * thunk_size, thunk_size, &thunk))
+                return false;
+            if (thunk == 0)
+                return true;
+            PEImport import;
+            import.dll = dll;
+            import.delayed = delayed;
+            import.iat_rva = iat_rva + i * thunk_size;
+            import.hint = 0;
+            import.ordinal = 0;
+            std::string name;
+            if (thunk & ordinal_flag)
+            {
+                import.by_name = false;
+                import.ordinal = (uint16_t)thunk;
+            }
+            else
+            {
+                // IMAGE_IMPORT_BY_NAME: hint, then the name
+                if (thunk > 0xFFFFFFFFull - 2)
+                    return false;
+                auto hint = read<uint16_t>((uint32_t)thunk);
+                name = string_at((uint32_t)thunk + 2);
+                if (!hint || name.empty())
+                    return false;
+                import.name = name;
+                import.by_name = true;
+                import.hint = *hint;
+            }
+            f(import);
+        }
+    }
+private:
+    const IProcessReader &_reader;
+    rptr_t _base;
+    std::vector<uint8_t> _header_bytes;
+    std::optional<PEView> _headers;
+
+    mutable std::mutex _lock;
+    // page index to its bytes, nullptr for pages that could not be read
+    std::unordered_map<uint32_t, std::unique_ptr<uint8_t[]>> _pages;
+    size_t _bytes_read = 0;
+    std::once_flag _exports_once;
+    std::optional<ExportDirectory> _exports;
+};
+
+}
@@ -0,0 +1,95 @@
+#include "SectionMap.h"
+
+#include <algorithm>
+#include <set>
+
+namespace pkn
+{
+
+void SectionMap::clear()
+{
+    _starts.clear();
+    _ends.clear();
+    _offsets.clear();
+    _pages.clear();
+}
+
+void SectionMap::build(const std::vector<Interval> &intervals)
+{
+    clear();
+
+    // sweep over interval boundaries, the active interval listed first owns each piece
+    struct Event
+    {
+        uint64_t position;
+        bool start;
+        uint32_t interval;
+    };
+    std::vector<Event> events;
+    events.reserve(intervals.size() * 2);
+    for (uint32_t i = 0; i < (uint32_t)intervals.size(); i++)
+    {
+        if (intervals[i].size == 0)
+            continue;
+        events.push_back(Event{ intervals[i].rva, true, i });
+        // rva are 32 bits, nothing maps past the end of the rva space
+        events.push_back(Event{ std::min<uint64_t>((uint64_t)intervals[i].rva + intervals[i].size, 0x100000000ull), false, i });
+    }
+    std::sort(events.begin(), events.end(), [](const Event &lhs, const Event &rhs)
+              {
+                  return lhs.position < rhs.position;
+              });
+
+    std::set<uint32_t> active;
+    for (size_t e = 0; e < events.size();)
+    {
+        uint64_t position = events[e].position;
+        for (; e < events.size() && events[e].position == position; e++)
+        {
+            if (events[e].start)
+                active.insert(events[e].interval);
+            else
+                active.erase(events[e].interval);
+        }
+        if (active.empty() || e == events.size())
+            continue;
+        const auto &owner = intervals[*active.begin()];
+        uint64_t end = events[e].position;
+        uint64_t offset = owner.offset + (position - owner.rva);
+        // extend the previous run if this piece continues it
+        if (!_starts.empty() && _ends.back() == position && _offsets.back() + (position - _starts.back()) == offset)
+        {
+            _ends.back() = end;
+            continue;
+        }
+        _starts.push_back((uint32_t)position);
+        _ends.push_back(end);
+        _offsets.push_back(offset);
+    }
+
+    if (_starts.empty() || _ends.back() > PageMapLimit)
+        return;
+    size_t pages = (size_t)((_ends.back() + (1ull << PageShift) - 1) >> PageShift);
+    _pages.resize(pages);
+    uint32_t run = 0;
+    for (size_t page = 0; page < pages; page++)
+    {
+        uint64_t page_start = (uint64_t)page << PageShift;
+        while (run < _starts.size() && _ends[run] <= page_start)
+            run++;
+        _pages[page] = run;
+    }
+}
+
+uint32_t SectionMap::upper_bound_end(uint32_t rva) const noexcept
+{
+    return (uint32_t)(std::upper_bound(_ends.begin(), _ends.end(), (uint64_t)rva) - _ends.begin());
+}
+
+void SectionMap::translate(const uint32_t *rvas, size_t count, uint64_t *offsets) const noexcept
+{
+    for (size_t i = 0; i < count; i++)
+        offsets[i] = translate(rvas[i]);
+}
+
+}
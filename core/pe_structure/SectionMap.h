@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace pkn
+{
+
+/*
+RVA to file offset translation table of a PE file.
+The intervals the sections(and headers) map are flattened once into sorted, non overlapping runs,
+so a translation is a binary search instead of a walk over the section headers.
+When the image is smaller than PageMapLimit, a per page table gives the first candidate run directly,
+which makes a translation O(1).
+
+usage:
+@code
+SectionMap map;
+map.build({ { section.VirtualAddress, section.SizeOfRawData, section.PointerToRawData }, ... });
+uint64_t offset;
+uint64_t available;
+if (map.locate(rva, offset, available))
+    ...;
+@endcode
+*/
+class SectionMap
+{
+public:
+    struct Interval
+    {
+        uint32_t rva;
+        uint32_t size;
+        uint64_t offset; // file offset of rva
+    };
+    constexpr static uint64_t NoOffset = ~(uint64_t)0;
+    constexpr static uint64_t PageMapLimit = 0x10000000; // 256MB of rva space, a 256KB page table
+    constexpr static uint32_t PageShift = 12;
+public:
+    // where intervals overlap, the one listed first wins
+    void build(const std::vector<Interval> &intervals);
+    void clear();
+public:
+    inline size_t size() const noexcept { return _starts.size(); }
+    inline bool empty() const noexcept { return _starts.empty(); }
+    inline bool has_page_map() const noexcept { return !_pages.empty(); }
+
+    // offset of rva, and the number of bytes mapped contiguously from there
+    inline bool locate(uint32_t rva, uint64_t &offset, uint64_t &available) const noexcept
+    {
+        auto run = find(rva);
+        if (run == NoRun)
+            return false;
+        offset = _offsets[run] + (rva - _starts[run]);
+        available = _ends[run] - rva;
+        return true;
+    }
+    inline uint64_t translate(uint32_t rva) const noexcept
+    {
+        auto run = find(rva);
+        return run == NoRun ? NoOffset : _offsets[run] + (rva - _starts[run]);
+    }
+    // offsets[i] = translate(rvas[i])
+    void translate(const uint32_t *rvas, size_t count, uint64_t *offsets) const noexcept;
+private:
+    constexpr static uint32_t NoRun = 0xFFFFFFFF;
+    inline uint32_t find(uint32_t rva) const noexcept
+    {
+        uint32_t run;
+        if (!_pages.empty())
+        {
+            size_t page = rva >> PageShift;
+            if (page >= _pages.size())
+                return NoRun;
+            // first run ending after the page start, runs are rarely smaller than a page
+            run = _pages[page];
+            while (run < _starts.size() && _ends[run] <= rva)
+                run++;
+        }
+        else
+        {
+            run = upper_bound_end(rva);
+        }
+        if (run >= _starts.size() || rva < _starts[run])
+            return NoRun;
+        return run;
+    }
+    // first run whose end is above rva
+    uint32_t upper_bound_end(uint32_t rva) const noexcept;
+private:
+    std::vector<uint32_t> _starts;  // sorted
+    std::vector<uint64_t> _ends;    // exclusive
+    std::vector<uint64_t> _offsets;
+    std::vector<uint32_t> _pages;
+};
+
+}
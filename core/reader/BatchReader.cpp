@@ -0,0 +1,106 @@
+#include "BatchReader.h"
+
+#include <algorithm>
+#include <string.h>
+
+namespace pkn
+{
+
+bool read_coalesced(const IProcessReader &reader, ReadRequest *requests, size_t count, const CoalesceOptions &options)
+{
+    if (count == 0)
+        return true;
+
+    std::vector<uint32_t> order(count);
+    for (uint32_t i = 0; i < (uint32_t)count; i++)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs)
+              {
+                  return requests[lhs].address < requests[rhs].address;
+              });
+
+    // group sorted requests into spans
+    struct Span
+    {
+        rptr_t begin;
+        rptr_t end;
+        size_t first; // index into order
+        size_t last;  // exclusive
+        bool solo;    // never merged with neighbours
+    };
+    std::vector<Span> spans;
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto &request = requests[order[i]];
+        rptr_t begin = request.address;
+        rptr_t end = begin + request.size;
+        if (end < begin || request.size > options.max_span)
+        {
+            // wrapped around or too large, read it on its own
+            spans.push_back(Span{ begin, begin, i, i + 1, true });
+            continue;
+        }
+        if (!spans.empty())
+        {
+            auto &span = spans.back();
+            if (!span.solo && begin <= span.end + options.max_gap && std::max(end, span.end) - span.begin <= options.max_span)
+            {
+                span.end = std::max(end, span.end);
+                span.last = i + 1;
+                continue;
+            }
+        }
+        spans.push_back(Span{ begin, end, i, i + 1, false });
+    }
+
+    bool all_success = true;
+    std::vector<ReadRequest> merged;
+    merged.reserve(spans.size());
+    std::vector<std::vector<uint8_t>> buffers(spans.size());
+    for (size_t s = 0; s < spans.size(); s++)
+    {
+        const auto &span = spans[s];
+        if (span.last - span.first == 1)
+        {
+            // a lonely request is read straight into its own buffer
+            auto &request = requests[order[span.first]];
+            merged.push_back(ReadRequest{ request.address, request.size, request.buffer, false });
+        }
+        else
+        {
+            buffers[s].resize((size_t)(span.end - span.begin));
+            merged.push_back(ReadRequest{ span.begin, buffers[s].size(), buffers[s].data(), false });
+        }
+    }
+    reader.read_batch(merged.data(), merged.size());
+
+    for (size_t s = 0; s < spans.size(); s++)
+    {
+        const auto &span = spans[s];
+        const auto &result = merged[s];
+        if (span.last - span.first == 1)
+        {
+            auto &request = requests[order[span.first]];
+            request.success = result.success;
+            all_success = all_success && request.success;
+            continue;
+        }
+        for (size_t i = span.first; i < span.last; i++)
+        {
+            auto &request = requests[order[i]];
+            if (result.success)
+            {
+                memcpy(request.buffer, buffers[s].data() + (request.address - span.begin), request.size);
+                request.success = true;
+            }
+            else
+            {
+                request.success = reader.read_unsafe(request.address, request.size, request.buffer);
+            }
+            all_success = all_success && request.success;
+        }
+    }
+    return all_success;
+}
+
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+
+#include "../base/types.h"
+#include "../remote_process/IProcess.h"
+
+namespace pkn
+{
+
+struct CoalesceOptions
+{
+    // requests separated by at most this many bytes are fetched with one read
+    size_t max_gap = 256;
+    // a merged read never grows beyond this size
+    size_t max_span = 0x10000;
+};
+
+/*
+Reads all requests, merging requests that are close in the address space into single reads.
+If a merged read fails, its requests are retried one by one, so a single unreadable page
+only fails the requests touching it.
+The merged reads are issued with a single read_batch() call.
+Requests may overlap and may be given in any order.
+Returns true if all requests succeeded, success of every request is filled.
+*/
+bool read_coalesced(const IProcessReader &reader, ReadRequest *requests, size_t count, const CoalesceOptions &options = CoalesceOptions());
+
+inline bool read_coalesced(const IProcessReader &reader, std::vector<ReadRequest> &requests, const CoalesceOptions &options = CoalesceOptions())
+{
+    return read_coalesced(reader, requests.data(), requests.size(), options);
+}
+
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace pkn
+{
+/*
+Compile-time description of the fields of a remote struct that are actually needed.
+Reading through a projection fetches only the byte spans covering those fields,
+spans closer than MaxGap bytes are merged because one more round trip costs more than a few extra bytes.
+
+usage:
+@code
+using ClassHead = FieldProjection<UClass, ProjectionDefaultGap,
+    PKN_FIELD(UClass, Name),
+    PKN_FIELD(UClass, Children)>;
+UClass c;
+tr.read_projected<ClassHead>(address, &c); // fields outside the projection are zeroed
+@endcode
+*/
+
+constexpr const size_t ProjectionDefaultGap = 256;
+
+template <size_t Offset, size_t Size>
+struct ProjectedField
+{
+    constexpr static const size_t offset = Offset;
+    constexpr static const size_t size = Size;
+};
+
+struct ProjectedSpan
+{
+    size_t offset;
+    size_t size;
+};
+
+template <class T, size_t MaxGap, class ...Fields>
+class FieldProjection
+{
+    static_assert(sizeof...(Fields) > 0, "a projection needs at least one field");
+public:
+    using type = T;
+    constexpr static const size_t field_count = sizeof...(Fields);
+private:
+    struct SpanList
+    {
+        ProjectedSpan spans[field_count];
+        size_t count;
+    };
+    static constexpr SpanList make_spans()
+    {
+        ProjectedSpan fields[field_count] = { ProjectedSpan{ Fields::offset, Fields::size }... };
+        // insertion sort, field_count is tiny
+        for (size_t i = 1; i < field_count; i++)
+        {
+            for (size_t j = i; j > 0 && fields[j].offset < fields[j - 1].offset; j--)
+            {
+                ProjectedSpan t = fields[j];
+                fields[j] = fields[j - 1];
+                fields[j - 1] = t;
+            }
+        }
+        SpanList result{};
+        result.spans[0] = fields[0];
+        result.count = 1;
+        for (size_t i = 1; i < field_count; i++)
+        {
+            auto &last = result.spans[result.count - 1];
+            size_t last_end = last.offset + last.size;
+            size_t end = fields[i].offset + fields[i].size;
+            if (fields[i].offset <= last_end + MaxGap)
+            {
+                if (end > last_end)
+                    last.size = end - last.offset;
+            }
+            else
+            {
+                result.spans[result.count++] = fields[i];
+            }
+        }
+        return result;
+    }
+    static constexpr size_t sum_bytes(const SpanList &list)
+    {
+        size_t n = 0;
+        for (size_t i = 0; i < list.count; i++)
+            n += list.spans[i].size;
+        return n;
+    }
+public:
+    constexpr static const SpanList span_list = make_spans();
+    constexpr static const size_t span_count = span_list.count;
+    constexpr static const size_t bytes_read = sum_bytes(span_list);
+
+    static_assert(span_list.spans[span_count - 1].offset + span_list.spans[span_count - 1].size <= sizeof(T), "projected field outside of struct");
+
+    static constexpr ProjectedSpan span(size_t i) { return span_list.spans[i]; }
+
+    // read_span(offset_in_struct, size, local_destination) -> bool
+    template <class ReadSpan>
+    static inline bool read(T *out, ReadSpan read_span) noexcept
+    {
+        memset((void *)out, 0, sizeof(T));
+        for (size_t i = 0; i < span_count; i++)
+        {
+            const auto &s = span_list.spans[i];
+            if (!read_span(s.offset, s.size, (uint8_t *)out + s.offset))
+                return false;
+        }
+        return true;
+    }
+};
+}
+
+// a whole member
+#define PKN_FIELD(type, member) ::pkn::ProjectedField<offsetof(type, member), sizeof(((type *)nullptr)->member)>
+
+// only the first `bytes` bytes of a member, e.g. a prefix of an inline string buffer
+#define PKN_FIELD_PREFIX(type, member, bytes) ::pkn::ProjectedField<offsetof(type, member), (bytes)>
@@ -0,0 +1,175 @@
+#include "PointerChain.h"
+
+namespace pkn
+{
+
+uint32_t PointerChainSet::child(uint32_t parent, int64_t offset, uint32_t depth)
+{
+    auto key = std::make_pair(parent, offset);
+    auto it = _children.find(key);
+    if (it != _children.end())
+        return it->second;
+
+    uint32_t id = (uint32_t)_nodes.size();
+    Node node;
+    node.parent = parent;
+    node.offset = offset;
+    node.depth = depth;
+    _nodes.push_back(node);
+    if (_levels.size() <= depth)
+        _levels.resize(depth + 1);
+    _levels[depth].push_back(id);
+    _children.emplace(key, id);
+    return id;
+}
+
+chain_id_t PointerChainSet::add(rptr_t base, const std::vector<int64_t> &offsets, size_t value_size)
+{
+    Chain chain;
+    chain.root = child(NoParent, (int64_t)base, 0);
+    uint32_t current = chain.root;
+    for (size_t i = 0; i < offsets.size(); i++)
+    {
+        // every node but the last one of a chain is dereferenced
+        if (i != 0)
+            _nodes[current].deref = true;
+        current = child(current, offsets[i], (uint32_t)i + 1);
+        chain.path.push_back(current);
+    }
+    chain.value_size = value_size;
+    chain.value_offset = _values.size();
+    _values.resize(_values.size() + value_size);
+    _chains.push_back(std::move(chain));
+    return (chain_id_t)(_chains.size() - 1);
+}
+
+void PointerChainSet::clear()
+{
+    _nodes.clear();
+    _levels.clear();
+    _children.clear();
+    _chains.clear();
+    _values.clear();
+}
+
+void PointerChainSet::invalidate() noexcept
+{
+    for (auto &node : _nodes)
+        node.read_tick = 0;
+}
+
+void PointerChainSet::resolve()
+{
+    ++_tick;
+    _last_read_count = 0;
+
+    std::vector<ReadRequest> requests;
+    std::vector<rptr_t> pointers;
+    std::unordered_map<rptr_t, size_t> request_for_address;
+    std::vector<uint32_t> pending;
+
+    if (!_levels.empty())
+    {
+        for (auto id : _levels[0])
+        {
+            auto &root = _nodes[id];
+            root.address = root.pointer = (rptr_t)root.offset;
+            root.reached = root.valid = true;
+        }
+    }
+
+    // level by level, every node of a level only depends on its parent
+    for (size_t depth = 1; depth < _levels.size(); depth++)
+    {
+        pending.clear();
+        request_for_address.clear();
+        for (auto id : _levels[depth])
+        {
+            auto &node = _nodes[id];
+            const auto &parent = _nodes[node.parent];
+            node.reached = parent.valid;
+            if (!node.reached)
+            {
+                node.valid = false;
+                continue;
+            }
+            node.address = parent.pointer + (rptr_t)node.offset;
+            if (!node.deref)
+                continue;
+            bool memoised = _memo_ticks != 0
+                && node.valid
+                && node.read_tick != 0
+                && node.read_address == node.address
+                && _tick - node.read_tick < _memo_ticks;
+            if (memoised)
+                continue;
+            pending.push_back(id);
+            request_for_address.emplace(node.address, request_for_address.size());
+        }
+        if (pending.empty())
+            continue;
+
+        pointers.assign(request_for_address.size(), rnullptr);
+        requests.resize(request_for_address.size());
+        for (const auto &p : request_for_address)
+            requests[p.second] = ReadRequest{ p.first, sizeof(rptr_t), &pointers[p.second], false };
+        read_coalesced(_reader, requests, _coalesce);
+        _last_read_count += requests.size();
+
+        for (auto id : pending)
+        {
+            auto &node = _nodes[id];
+            auto index = request_for_address[node.address];
+            node.pointer = pointers[index];
+            node.valid = requests[index].success && node.pointer != rnullptr;
+            node.read_tick = _tick;
+            node.read_address = node.address;
+        }
+    }
+
+    // final addresses and values
+    std::map<std::pair<rptr_t, size_t>, size_t> request_for_value;
+    std::vector<chain_id_t> value_chains;
+    requests.clear();
+    for (chain_id_t id = 0; id < (chain_id_t)_chains.size(); id++)
+    {
+        auto &chain = _chains[id];
+        auto &result = chain.result;
+        result.failed_level = -1;
+        result.address = _nodes[chain.root].address;
+        for (size_t i = 0; i < chain.path.size(); i++)
+        {
+            const auto &node = _nodes[chain.path[i]];
+            bool last = i + 1 == chain.path.size();
+            if (!node.reached)
+                break; // the failure was recorded on the previous node
+            result.address = node.address;
+            if (!last && !node.valid)
+            {
+                result.failed_level = (int)i;
+                break;
+            }
+        }
+        if (!result.ok() || chain.value_size == 0)
+            continue;
+        auto key = std::make_pair(result.address, chain.value_size);
+        if (request_for_value.emplace(key, requests.size()).second)
+            requests.push_back(ReadRequest{ result.address, chain.value_size, &_values[chain.value_offset], false });
+        value_chains.push_back(id);
+    }
+    if (requests.empty())
+        return;
+    read_coalesced(_reader, requests, _coalesce);
+    _last_read_count += requests.size();
+    for (auto id : value_chains)
+    {
+        auto &chain = _chains[id];
+        const auto &request = requests[request_for_value[std::make_pair(chain.result.address, chain.value_size)]];
+        if (!request.success)
+            chain.result.failed_level = (int)chain.path.size();
+        else if (request.buffer != &_values[chain.value_offset])
+            memcpy(&_values[chain.value_offset], request.buffer, chain.value_size);
+    }
+}
+
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+
+#include "../base/types.h"
+#include "../remote_process/IProcess.h"
+#include "BatchReader.h"
+
+namespace pkn
+{
+
+using chain_id_t = uint32_t;
+
+struct PointerChainResult
+{
+    // final address, the last pointer plus the last offset
+    rptr_t address = rnullptr;
+    // index of the offset whose read failed (or produced a null pointer),
+    // offsets.size() if only the value read failed, -1 on success
+    int failed_level = -1;
+public:
+    inline bool ok() const noexcept { return failed_level < 0; }
+};
+
+/*
+Resolves many multi-level pointer chains at once.
+A chain { base, { 0x10, 0x88, 0x20 } } means: read the pointer at base+0x10, then the pointer at that+0x88,
+the final address is that+0x20. Optionally value_size bytes are read at the final address.
+
+Chains are kept in a prefix tree, so chains sharing a prefix share its reads,
+and resolve() reads each level of the tree with one deduplicated, coalesced batch.
+Intermediate pointers whose address did not change are reused for memo_ticks ticks before being read again.
+
+usage:
+@code
+PointerChainSet chains(reader, 4);
+auto health = chains.add(base, { 0x10, 0x88, 0x20 }, sizeof(float));
+while (running)
+{
+    chains.resolve();
+    if (auto v = chains.value_as<float>(health))
+        ...;
+}
+@endcode
+*/
+class PointerChainSet
+{
+public:
+    PointerChainSet(const IProcessReader &reader, uint32_t memo_ticks = 0, const CoalesceOptions &coalesce = CoalesceOptions())
+        : _reader(reader), _memo_ticks(memo_ticks), _coalesce(coalesce)
+    {}
+public:
+    chain_id_t add(rptr_t base, const std::vector<int64_t> &offsets, size_t value_size = 0);
+    void clear();
+    // forget memoised pointers, the next resolve() reads every level again
+    void invalidate() noexcept;
+
+    // one tick, resolves every registered chain
+    void resolve();
+public:
+    inline size_t size() const noexcept { return _chains.size(); }
+    inline uint64_t tick() const noexcept { return _tick; }
+    inline const PointerChainResult &result(chain_id_t id) const { return _chains[id].result; }
+    // value_size bytes read at the final address, nullptr if the chain failed or has no value
+    inline const uint8_t *value(chain_id_t id) const
+    {
+        const auto &chain = _chains[id];
+        if (!chain.result.ok() || chain.value_size == 0)
+            return nullptr;
+        return &_values[chain.value_offset];
+    }
+    template <class T>
+    inline std::optional<T> value_as(chain_id_t id) const
+    {
+        const auto &chain = _chains[id];
+        if (chain.value_size < sizeof(T))
+            return std::nullopt;
+        if (auto p = value(id))
+        {
+            T v;
+            memcpy(&v, p, sizeof(T));
+            return v;
+        }
+        return std::nullopt;
+    }
+    // reads issued by the last resolve(), after deduplication and before coalescing
+    inline size_t last_read_count() const noexcept { return _last_read_count; }
+private:
+    constexpr static const uint32_t NoParent = 0xFFFFFFFF;
+    struct Node
+    {
+        uint32_t parent;    // NoParent for roots
+        int64_t offset;     // for roots: the base address
+        uint32_t depth;     // roots are 0
+        bool deref = false; // some chain continues below this node
+        rptr_t address = rnullptr;
+        rptr_t pointer = rnullptr; // value read at address, roots hold their base
+        bool reached = false;      // address is known
+        bool valid = false;        // pointer was read and is not null
+        uint64_t read_tick = 0;
+        rptr_t read_address = rnullptr; // address pointer was read from
+    };
+    struct Chain
+    {
+        uint32_t root;
+        std::vector<uint32_t> path; // one node per offset
+        size_t value_size;
+        size_t value_offset;
+        PointerChainResult result;
+    };
+private:
+    uint32_t child(uint32_t parent, int64_t offset, uint32_t depth);
+private:
+    const IProcessReader &_reader;
+    uint32_t _memo_ticks;
+    CoalesceOptions _coalesce;
+    uint64_t _tick = 0;
+    size_t _last_read_count = 0;
+
+    std::vector<Node> _nodes;
+    std::vector<std::vector<uint32_t>> _levels; // node ids by depth
+    std::map<std::pair<uint32_t, int64_t>, uint32_t> _children;
+    std::vector<Chain> _chains;
+    std::vector<uint8_t> _values;
+};
+
+}
@@ -0,0 +1,226 @@
+#include "ReadInstrumentation.h"
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
+namespace pkn
+{
+
+void ReadHistogram::merge(const ReadHistogram &rhs) noexcept
+{
+    for (size_t i = 0; i < BucketCount; i++)
+        counts[i] += rhs.counts[i];
+}
+
+uint64_t ReadHistogram::total() const noexcept
+{
+    uint64_t n = 0;
+    for (auto c : counts)
+        n += c;
+    return n;
+}
+
+uint64_t ReadHistogram::percentile(double fraction) const noexcept
+{
+    auto n = total();
+    if (n == 0)
+        return 0;
+    auto rank = (uint64_t)(fraction * (double)n);
+    if (rank >= n)
+        rank = n - 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BucketCount; i++)
+    {
+        seen += counts[i];
+        if (seen > rank)
+            return bucket_lower_bound(i);
+    }
+    return bucket_lower_bound(BucketCount - 1);
+}
+
+size_t ReadInstrumentation::shard_index() noexcept
+{
+    static std::atomic<size_t> next_thread_index{ 0 };
+    static thread_local size_t index = next_thread_index.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+    return index;
+}
+
+void ReadInstrumentation::record_tag(Shard &shard, const char *tag, size_t size, uint64_t nanoseconds, bool success) noexcept
+{
+    // open addressing on the tag address, tags beyond TagSlots distinct call sites per shard are dropped
+    size_t start = (size_t)(((uintptr_t)tag >> 3) % TagSlots);
+    for (size_t i = 0; i < TagSlots; i++)
+    {
+        auto &slot = shard.tags[(start + i) % TagSlots];
+        const char *current = slot.tag.load(std::memory_order_acquire);
+        if (current == nullptr)
+        {
+            if (!slot.tag.compare_exchange_strong(current, tag, std::memory_order_acq_rel) && current != tag)
+                continue;
+        }
+        else if (current != tag)
+        {
+            continue;
+        }
+        add(slot.calls, 1);
+        add(slot.bytes, size);
+        add(slot.total_nanoseconds, nanoseconds);
+        if (!success)
+            add(slot.failures, 1);
+        return;
+    }
+}
+
+ReadStatistics ReadInstrumentation::snapshot() const
+{
+    ReadStatistics stats;
+    std::unordered_map<const char *, ReadTagStatistics> tags;
+    for (const auto &shard : _shards)
+    {
+        stats.calls += shard.calls.load(std::memory_order_relaxed);
+        stats.bytes += shard.bytes.load(std::memory_order_relaxed);
+        stats.failures += shard.failures.load(std::memory_order_relaxed);
+        stats.total_nanoseconds += shard.total_nanoseconds.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < ReadHistogram::BucketCount; i++)
+        {
+            stats.latency_ns.counts[i] += shard.latency_ns[i].load(std::memory_order_relaxed);
+            stats.size_bytes.counts[i] += shard.size_bytes[i].load(std::memory_order_relaxed);
+        }
+        for (const auto &slot : shard.tags)
+        {
+            auto tag = slot.tag.load(std::memory_order_acquire);
+            if (tag == nullptr)
+                continue;
+            auto &t = tags[tag];
+            t.tag = tag;
+            t.calls += slot.calls.load(std::memory_order_relaxed);
+            t.bytes += slot.bytes.load(std::memory_order_relaxed);
+            t.failures += slot.failures.load(std::memory_order_relaxed);
+            t.total_nanoseconds += slot.total_nanoseconds.load(std::memory_order_relaxed);
+        }
+    }
+    for (auto &p : tags)
+        stats.tags.push_back(std::move(p.second));
+    std::sort(stats.tags.begin(), stats.tags.end(), [](const ReadTagStatistics &lhs, const ReadTagStatistics &rhs)
+              {
+                  return lhs.total_nanoseconds > rhs.total_nanoseconds;
+              });
+    return stats;
+}
+
+void ReadInstrumentation::reset() noexcept
+{
+    // reads racing with reset() may survive partially, which is fine for statistics
+    for (auto &shard : _shards)
+    {
+        shard.calls.store(0, std::memory_order_relaxed);
+        shard.bytes.store(0, std::memory_order_relaxed);
+        shard.failures.store(0, std::memory_order_relaxed);
+        shard.total_nanoseconds.store(0, std::memory_order_relaxed);
+        for (size_t i = 0; i < ReadHistogram::BucketCount; i++)
+        {
+            shard.latency_ns[i].store(0, std::memory_order_relaxed);
+            shard.size_bytes[i].store(0, std::memory_order_relaxed);
+        }
+        for (auto &slot : shard.tags)
+        {
+            slot.calls.store(0, std::memory_order_relaxed);
+            slot.bytes.store(0, std::memory_order_relaxed);
+            slot.failures.store(0, std::memory_order_relaxed);
+            slot.total_nanoseconds.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+static void write_json_string(std::ostringstream &os, const std::string &s)
+{
+    os << '"';
+    for (char ch : s)
+    {
+        if (ch == '"' || ch == '\\')
+            os << '\\' << ch;
+        else if ((unsigned char)ch < 0x20)
+            os << ' ';
+        else
+            os << ch;
+    }
+    os << '"';
+}
+
+static void write_json_histogram(std::ostringstream &os, const ReadHistogram &h)
+{
+    os << "{\"p50\":" << h.percentile(0.5)
+        << ",\"p90\":" << h.percentile(0.9)
+        << ",\"p99\":" << h.percentile(0.99)
+        << ",\"p999\":" << h.percentile(0.999)
+        << ",\"buckets\":[";
+    bool first = true;
+    for (size_t i = 0; i < ReadHistogram::BucketCount; i++)
+    {
+        if (h.counts[i] == 0)
+            continue;
+        if (!first)
+            os << ',';
+        first = false;
+        os << '[' << ReadHistogram::bucket_lower_bound(i) << ',' << h.counts[i] << ']';
+    }
+    os << "]}";
+}
+
+std::string ReadStatistics::to_text(size_t max_tags) const
+{
+    std::ostringstream os;
+    os << "[" << backend << "] calls: " << calls
+        << " bytes: " << bytes
+        << " failures: " << failures
+        << " total: " << total_nanoseconds / 1000 << "us\n";
+    os << "  latency(ns) p50: " << latency_ns.percentile(0.5)
+        << " p90: " << latency_ns.percentile(0.9)
+        << " p99: " << latency_ns.percentile(0.99)
+        << " p99.9: " << latency_ns.percentile(0.999) << "\n";
+    os << "  size(bytes) p50: " << size_bytes.percentile(0.5)
+        << " p90: " << size_bytes.percentile(0.9)
+        << " p99: " << size_bytes.percentile(0.99) << "\n";
+    for (size_t i = 0; i < tags.size() && i < max_tags; i++)
+    {
+        const auto &t = tags[i];
+        os << "  " << t.tag << ": calls " << t.calls
+            << " bytes " << t.bytes
+            << " failures " << t.failures
+            << " total " << t.total_nanoseconds / 1000 << "us\n";
+    }
+    return os.str();
+}
+
+std::string ReadStatistics::to_json(size_t max_tags) const
+{
+    std::ostringstream os;
+    os << "{\"backend\":";
+    write_json_string(os, backend);
+    os << ",\"calls\":" << calls
+        << ",\"bytes\":" << bytes
+        << ",\"failures\":" << failures
+        << ",\"total_ns\":" << total_nanoseconds
+        << ",\"latency_ns\":";
+    write_json_histogram(os, latency_ns);
+    os << ",\"size_bytes\":";
+    write_json_histogram(os, size_bytes);
+    os << ",\"tags\":[";
+    for (size_t i = 0; i < tags.size() && i < max_tags; i++)
+    {
+        const auto &t = tags[i];
+        if (i != 0)
+            os << ',';
+        os << "{\"tag\":";
+        write_json_string(os, t.tag);
+        os << ",\"calls\":" << t.calls
+            << ",\"bytes\":" << t.bytes
+            << ",\"failures\":" << t.failures
+            << ",\"total_ns\":" << t.total_nanoseconds << '}';
+    }
+    os << "]}";
+    return os.str();
+}
+
+}
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../base/types.h"
+#include "../remote_process/IProcess.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*
+Read-path instrumentation at the IProcessReader boundary.
+Set PKN_ENABLE_READ_INSTRUMENTATION to 1 in the project defines to enable it,
+when it is 0 instrument_reader() returns the reader untouched and PKN_READ_TAG() expands to nothing.
+*/
+#ifndef PKN_ENABLE_READ_INSTRUMENTATION
+#define PKN_ENABLE_READ_INSTRUMENTATION 0
+#endif
+
+namespace pkn
+{
+
+/*
+HDR-style histogram: every power of two is split into 8 linear sub buckets,
+so the relative error of any recorded value is below 12.5%.
+*/
+class ReadHistogram
+{
+public:
+    constexpr static const int SubBucketBits = 3;
+    constexpr static const size_t SubBuckets = 1 << SubBucketBits;
+    constexpr static const size_t BucketCount = (64 - SubBucketBits + 1) * SubBuckets;
+public:
+    static inline size_t bucket_for(uint64_t value) noexcept
+    {
+        if (value < SubBuckets)
+            return (size_t)value;
+        int msb = most_significant_bit(value);
+        int shift = msb - SubBucketBits;
+        return (size_t)(shift + 1) * SubBuckets + (size_t)((value >> shift) & (SubBuckets - 1));
+    }
+    static inline uint64_t bucket_lower_bound(size_t bucket) noexcept
+    {
+        if (bucket < SubBuckets)
+            return bucket;
+        size_t shift = bucket / SubBuckets - 1;
+        return (uint64_t)(SubBuckets + bucket % SubBuckets) << shift;
+    }
+    static inline int most_significant_bit(uint64_t value) noexcept
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return (int)index;
+#else
+        return 63 - __builtin_clzll(value);
+#endif
+    }
+public:
+    void record(uint64_t value, uint64_t times = 1) noexcept { counts[bucket_for(value)] += times; }
+    void merge(const ReadHistogram &rhs) noexcept;
+    uint64_t total() const noexcept;
+    // value below which the given fraction(0.0-1.0) of samples fall, reported as the bucket lower bound
+    uint64_t percentile(double fraction) const noexcept;
+public:
+    uint64_t counts[BucketCount] = {};
+};
+
+struct ReadTagStatistics
+{
+    std::string tag;
+    uint64_t calls = 0;
+    uint64_t bytes = 0;
+    uint64_t failures = 0;
+    uint64_t total_nanoseconds = 0;
+};
+
+// merged, plain copy of the counters of one instrumented reader
+struct ReadStatistics
+{
+    std::string backend;
+    uint64_t calls = 0;
+    uint64_t bytes = 0;
+    uint64_t failures = 0;
+    uint64_t total_nanoseconds = 0;
+    ReadHistogram latency_ns;
+    ReadHistogram size_bytes;
+    std::vector<ReadTagStatistics> tags; // sorted by total_nanoseconds, descending
+public:
+    std::string to_text(size_t max_tags = 16) const;
+    std::string to_json(size_t max_tags = 16) const;
+};
+
+/*
+Tags the reads issued by the current thread inside a scope, so they can be attributed to a call site.
+tag must be a string with static storage duration, it is compared by address.
+*/
+class ReadTagScope
+{
+public:
+    explicit ReadTagScope(const char *tag) noexcept : _previous(current()) { current() = tag; }
+    ~ReadTagScope() { current() = _previous; }
+    ReadTagScope(const ReadTagScope &) = delete;
+    void operator=(const ReadTagScope &) = delete;
+public:
+    static inline const char *&current() noexcept
+    {
+        static thread_local const char *tag = nullptr;
+        return tag;
+    }
+private:
+    const char *_previous;
+};
+
+class ReadInstrumentation
+{
+public:
+    constexpr static const size_t ShardCount = 64;
+    constexpr static const size_t TagSlots = 32;
+public:
+    inline void record(size_t size, uint64_t nanoseconds, bool success) noexcept
+    {
+        auto &shard = _shards[shard_index()];
+        add(shard.calls, 1);
+        add(shard.bytes, size);
+        add(shard.total_nanoseconds, nanoseconds);
+        if (!success)
+            add(shard.failures, 1);
+        add(shard.latency_ns[ReadHistogram::bucket_for(nanoseconds)], 1);
+        add(shard.size_bytes[ReadHistogram::bucket_for(size)], 1);
+        if (auto tag = ReadTagScope::current())
+            record_tag(shard, tag, size, nanoseconds, success);
+    }
+    ReadStatistics snapshot() const;
+    void reset() noexcept;
+private:
+    using counter_t = std::atomic<uint64_t>;
+    struct TagSlot
+    {
+        std::atomic<const char *> tag{ nullptr };
+        counter_t calls{ 0 };
+        counter_t bytes{ 0 };
+        counter_t failures{ 0 };
+        counter_t total_nanoseconds{ 0 };
+    };
+    struct alignas(64) Shard
+    {
+        counter_t calls{ 0 };
+        counter_t bytes{ 0 };
+        counter_t failures{ 0 };
+        counter_t total_nanoseconds{ 0 };
+        counter_t latency_ns[ReadHistogram::BucketCount] = {};
+        counter_t size_bytes[ReadHistogram::BucketCount] = {};
+        TagSlot tags[TagSlots];
+    };
+private:
+    // shards are almost never shared between threads, so the adds stay uncontended
+    static inline void add(counter_t &counter, uint64_t value) noexcept
+    {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+    static size_t shard_index() noexcept;
+    static void record_tag(Shard &shard, const char *tag, size_t size, uint64_t nanoseconds, bool success) noexcept;
+private:
+    Shard _shards[ShardCount];
+};
+
+// decorator counting every read passing through it
+class InstrumentedReader : public IProcessReader
+{
+public:
+    InstrumentedReader(IProcessReader *reader, const char *backend_name)
+        : _reader(reader), _backend_name(backend_name)
+    {}
+    virtual ~InstrumentedReader() override = default;
+public:
+    virtual bool read_unsafe(const erptr_t &address, size_t size, void *buffer) const override
+    {
+        auto begin = std::chrono::steady_clock::now();
+        bool success = _reader->read_unsafe(address, size, buffer);
+        auto end = std::chrono::steady_clock::now();
+        _instrumentation.record(size, (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count(), success);
+        return success;
+    }
+    // forwarded as a batch, so the backend keeps its round trip; each request is counted with an equal share of the time
+    virtual bool read_batch(ReadRequest *requests, size_t count) const override
+    {
+        if (count == 0)
+            return true;
+        auto begin = std::chrono::steady_clock::now();
+        bool all_success = _reader->read_batch(requests, count);
+        auto end = std::chrono::steady_clock::now();
+        uint64_t share = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() / count;
+        for (size_t i = 0; i < count; i++)
+            _instrumentation.record(requests[i].size, share, requests[i].success);
+        return all_success;
+    }
+public:
+    inline ReadStatistics statistics() const
+    {
+        auto stats = _instrumentation.snapshot();
+        stats.backend = _backend_name;
+        return stats;
+    }
+    inline void reset_statistics() noexcept { _instrumentation.reset(); }
+    inline IProcessReader *inner() const noexcept { return _reader; }
+private:
+    IProcessReader *_reader;
+    const char *_backend_name;
+    mutable ReadInstrumentation _instrumentation;
+};
+
+/*
+Wraps reader with an InstrumentedReader when instrumentation is compiled in.
+The returned reader is owned by the caller if it differs from the input.
+*/
+inline IProcessReader *instrument_reader(IProcessReader *reader, const char *backend_name)
+{
+#if PKN_ENABLE_READ_INSTRUMENTATION
+    return new InstrumentedReader(reader, backend_name);
+#else
+    (void)backend_name;
+    return reader;
+#endif
+}
+
+// statistics of reader if it is instrumented
+inline std::optional<ReadStatistics> read_statistics(const IProcessReader *reader)
+{
+    if (auto instrumented = dynamic_cast<const InstrumentedReader *>(reader))
+        return instrumented->statistics();
+    return std::nullopt;
+}
+}
+
+#define PKN_READ_TAG_CONCAT_IMPL(a, b) a##b
+#define PKN_READ_TAG_CONCAT(a, b) PKN_READ_TAG_CONCAT_IMPL(a, b)
+#if PKN_ENABLE_READ_INSTRUMENTATION
+#define PKN_READ_TAG(tag) ::pkn::ReadTagScope PKN_READ_TAG_CONCAT(__pkn_read_tag_, __LINE__)(tag)
+#else
+#define PKN_READ_TAG(tag) void()
+#endif
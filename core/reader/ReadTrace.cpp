@@ -0,0 +1,173 @@
+#include "ReadTrace.h"
+
+#include <string.h>
+
+namespace pkn
+{
+
+static inline uint64_t zigzag_encode(int64_t value) noexcept
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static inline int64_t zigzag_decode(uint64_t value) noexcept
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+static bool get_varint(const uint8_t *&p, const uint8_t *end, uint64_t *value) noexcept
+{
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7)
+    {
+        uint8_t byte = *p++;
+        result |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+        {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ReadTraceWriter::open(const char *path)
+{
+    // appends from other threads see either the old trace or the new one, never a mix of their state
+    std::lock_guard<std::mutex> l(_lock);
+    close_locked();
+#ifdef _MSC_VER
+    if (fopen_s(&_file, path, "wb") != 0)
+        _file = nullptr;
+#else
+    _file = fopen(path, "wb");
+#endif
+    if (_file == nullptr)
+        return false;
+    ReadTraceHeader header;
+    memcpy(header.magic, ReadTraceMagic, sizeof(header.magic));
+    header.version = ReadTraceVersion;
+    header.reserved = 0;
+    _last_address = 0;
+    _last_timestamp = 0;
+    return fwrite(&header, sizeof(header), 1, _file) == 1;
+}
+
+void ReadTraceWriter::close()
+{
+    std::lock_guard<std::mutex> l(_lock);
+    close_locked();
+}
+
+void ReadTraceWriter::close_locked()
+{
+    if (_file)
+    {
+        fclose(_file);
+        _file = nullptr;
+    }
+}
+
+void ReadTraceWriter::put_varint(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        _scratch.push_back(uint8_t(value | 0x80));
+        value >>= 7;
+    }
+    _scratch.push_back(uint8_t(value));
+}
+
+bool ReadTraceWriter::append(uint64_t address, uint64_t size, uint64_t timestamp_ns, uint64_t latency_ns, bool success, const void *data)
+{
+    std::lock_guard<std::mutex> l(_lock);
+    if (_file == nullptr)
+        return false;
+    // concurrent readers may append slightly out of timestamp order, keep deltas non-negative
+    if (timestamp_ns < _last_timestamp)
+        timestamp_ns = _last_timestamp;
+
+    _scratch.clear();
+    put_varint(zigzag_encode((int64_t)(address - _last_address)));
+    put_varint(size);
+    put_varint(timestamp_ns - _last_timestamp);
+    put_varint(latency_ns);
+    _scratch.push_back(success ? ReadTraceFlagSuccess : 0);
+    _last_address = address;
+    _last_timestamp = timestamp_ns;
+
+    if (fwrite(_scratch.data(), 1, _scratch.size(), _file) != _scratch.size())
+        return false;
+    if (success && size != 0)
+        return fwrite(data, 1, (size_t)size, _file) == size;
+    return true;
+}
+
+bool ReadTrace::load(const char *path)
+{
+    FILE *file = nullptr;
+#ifdef _MSC_VER
+    if (fopen_s(&file, path, "rb") != 0)
+        return false;
+#else
+    file = fopen(path, "rb");
+    if (file == nullptr)
+        return false;
+#endif
+    std::vector<uint8_t> bytes;
+    uint8_t chunk[0x10000];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) != 0)
+        bytes.insert(bytes.end(), chunk, chunk + n);
+    fclose(file);
+    return parse(std::move(bytes));
+}
+
+bool ReadTrace::parse(std::vector<uint8_t> bytes)
+{
+    _bytes = std::move(bytes);
+    _records.clear();
+    if (_bytes.size() < sizeof(ReadTraceHeader))
+        return false;
+    ReadTraceHeader header;
+    memcpy(&header, _bytes.data(), sizeof(header));
+    if (memcmp(header.magic, ReadTraceMagic, sizeof(header.magic)) != 0 || header.version != ReadTraceVersion)
+        return false;
+
+    const uint8_t *begin = _bytes.data();
+    const uint8_t *p = begin + sizeof(header);
+    const uint8_t *end = begin + _bytes.size();
+    uint64_t address = 0;
+    uint64_t timestamp = 0;
+    while (p < end)
+    {
+        uint64_t address_delta, size, timestamp_delta, latency;
+        if (!get_varint(p, end, &address_delta)
+            || !get_varint(p, end, &size)
+            || !get_varint(p, end, &timestamp_delta)
+            || !get_varint(p, end, &latency)
+            || p >= end)
+            return false; // truncated trace
+        uint8_t flags = *p++;
+        address += (uint64_t)zigzag_decode(address_delta);
+        timestamp += timestamp_delta;
+
+        ReadTraceRecord record;
+        record.address = address;
+        record.size = size;
+        record.timestamp_ns = timestamp;
+        record.latency_ns = latency;
+        record.success = (flags & ReadTraceFlagSuccess) != 0;
+        record.data_offset = (size_t)(p - begin);
+        if (record.success)
+        {
+            if ((uint64_t)(end - p) < size)
+                return false;
+            p += size;
+        }
+        _records.push_back(record);
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+Compact binary trace of remote reads, used for deterministic replay.
+This file only depends on the standard library so traces can be consumed on any platform.
+
+layout:
+    ReadTraceHeader
+    record*, each record is
+        varint  zigzag(address - previous address)
+        varint  size
+        varint  timestamp - previous timestamp (ns)
+        varint  latency (ns)
+        uint8   flags (ReadTraceFlagSuccess)
+        uint8   data[size]  (only present if the read succeeded)
+*/
+
+namespace pkn
+{
+
+constexpr const char ReadTraceMagic[8] = { 'P', 'K', 'N', 'R', 'T', 'R', 'C', '\0' };
+constexpr const uint32_t ReadTraceVersion = 1;
+constexpr const uint8_t ReadTraceFlagSuccess = 0x01;
+
+#pragma pack(push, 1)
+struct ReadTraceHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+};
+#pragma pack(pop)
+
+struct ReadTraceRecord
+{
+    uint64_t address;
+    uint64_t size;
+    uint64_t timestamp_ns;  // since the recording started(RecordingReader construction), never decreasing
+    uint64_t latency_ns;
+    bool success;
+    size_t data_offset;     // offset into ReadTrace::data(), valid if success
+};
+
+class ReadTraceWriter
+{
+public:
+    ReadTraceWriter() = default;
+    ~ReadTraceWriter() { close(); }
+    ReadTraceWriter(const ReadTraceWriter &) = delete;
+    void operator=(const ReadTraceWriter &) = delete;
+public:
+    bool open(const char *path);
+    void close();
+    inline bool is_open() const noexcept { return _file != nullptr; }
+
+    // thread safe, records are stored in the order append() is called
+    bool append(uint64_t address, uint64_t size, uint64_t timestamp_ns, uint64_t latency_ns, bool success, const void *data);
+private:
+    // _lock held
+    void close_locked();
+    void put_varint(uint64_t value);
+private:
+    std::mutex _lock;
+    FILE *_file = nullptr;
+    std::vector<uint8_t> _scratch;
+    uint64_t _last_address = 0;
+    uint64_t _last_timestamp = 0;
+};
+
+class ReadTrace
+{
+public:
+    bool load(const char *path);
+    bool parse(std::vector<uint8_t> bytes);
+public:
+    inline const std::vector<ReadTraceRecord> &records() const noexcept { return _records; }
+    inline const uint8_t *data(const ReadTraceRecord &record) const noexcept { return _bytes.data() + record.data_offset; }
+    inline size_t size() const noexcept { return _records.size(); }
+private:
+    std::vector<uint8_t> _bytes;
+    std::vector<ReadTraceRecord> _records;
+};
+
+}
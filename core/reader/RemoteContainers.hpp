@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "../base/types.h"
+#include "../remote_process/IProcess.h"
+#include "BatchReader.h"
+
+/*
+Views over containers living in the remote process.
+They are single pass input ranges: iterating fetches the elements chunk by chunk,
+so walking a big array costs a handful of read_batch() calls instead of one read per element.
+Backends overriding read_batch() (KernelProcess) serve each of them with one round trip; with the
+default read_batch() only pointees close enough to be coalesced share a read.
+
+usage:
+@code
+RemoteArray<FVector> positions(reader, (rptr_t)array.Data, array.Count);
+for (const auto &position : positions)
+    ...;
+
+RemotePointerArray<UObject> objects(reader, (rptr_t)objects_array.Data, objects_array.Count);
+for (const auto &element : objects)
+    if (element.valid)
+        use(element.address, element.value);
+
+RemoteLinkedList<UField, &UField::Next> fields(reader, (rptr_t)ustruct.Children);
+for (const auto &field : fields)
+    ...;
+@endcode
+*/
+
+namespace pkn
+{
+
+constexpr const size_t RemoteContainerDefaultChunk = 1024;
+
+namespace detail
+{
+// input iterator over any view exposing bool load(size_t index) and const value_type &loaded(size_t index)
+template <class View>
+class RemoteViewIterator
+{
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename View::value_type;
+    using difference_type = ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+public:
+    RemoteViewIterator() = default;
+    RemoteViewIterator(View *view, size_t index) : _view(view), _index(index) { settle(); }
+public:
+    reference operator*() const { return _view->loaded(_index); }
+    pointer operator->() const { return &_view->loaded(_index); }
+    RemoteViewIterator &operator++() { ++_index; settle(); return *this; }
+    void operator++(int) { ++*this; }
+    bool operator==(const RemoteViewIterator &rhs) const noexcept { return _index == rhs._index; }
+    bool operator!=(const RemoteViewIterator &rhs) const noexcept { return _index != rhs._index; }
+private:
+    // a failed chunk ends the iteration
+    void settle()
+    {
+        if (_view && _index < _view->size() && !_view->load(_index))
+            _index = _view->size();
+    }
+private:
+    View *_view = nullptr;
+    size_t _index = 0;
+};
+}
+
+template <class T>
+struct RemoteElement
+{
+    rptr_t address;  // remote address the element was read from
+    T value;
+    bool valid;      // false if the pointer was null or unreadable
+};
+
+// a contiguous remote array, data pointer + count
+template <class T>
+class RemoteArray
+{
+    static_assert(std::is_trivially_copyable_v<T>, "remote elements are copied bytewise");
+public:
+    using value_type = T;
+    using iterator = detail::RemoteViewIterator<RemoteArray<T>>;
+public:
+    RemoteArray(const IProcessReader &reader, rptr_t data, size_t count, size_t chunk_size = RemoteContainerDefaultChunk)
+        : _reader(reader), _data(data), _count(data == rnullptr ? 0 : count), _chunk_size(std::max<size_t>(chunk_size, 1))
+    {}
+public:
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, _count); }
+    inline size_t size() const noexcept { return _count; }
+    inline rptr_t data() const noexcept { return _data; }
+    inline rptr_t address_of(size_t index) const noexcept { return _data + index * sizeof(T); }
+    // false if a chunk could not be read and the iteration stopped early
+    inline bool ok() const noexcept { return !_failed; }
+
+    // the whole array, chunk by chunk
+    std::optional<std::vector<T>> read_all() const
+    {
+        std::vector<T> result(_count);
+        for (size_t first = 0; first < _count; first += _chunk_size)
+        {
+            size_t n = std::min(_chunk_size, _count - first);
+            if (!_reader.read_unsafe(address_of(first), n * sizeof(T), &result[first]))
+                return std::nullopt;
+        }
+        return result;
+    }
+public:
+    bool load(size_t index)
+    {
+        if (_loaded && index >= _chunk_first && index < _chunk_first + _chunk.size())
+            return true;
+        _chunk_first = index / _chunk_size * _chunk_size;
+        _chunk.resize(std::min(_chunk_size, _count - _chunk_first));
+        _loaded = _reader.read_unsafe(address_of(_chunk_first), _chunk.size() * sizeof(T), _chunk.data());
+        _failed = _failed || !_loaded;
+        return _loaded;
+    }
+    inline const T &loaded(size_t index) const { return _chunk[index - _chunk_first]; }
+private:
+    const IProcessReader &_reader;
+    rptr_t _data;
+    size_t _count;
+    size_t _chunk_size;
+    std::vector<T> _chunk;
+    size_t _chunk_first = 0;
+    bool _loaded = false;
+    bool _failed = false;
+};
+
+/*
+A remote array of pointers to T.
+Each chunk costs one read for the pointers and one coalesced batch(one read_batch() call) for the pointees.
+*/
+template <class T>
+class RemotePointerArray
+{
+    static_assert(std::is_trivially_copyable_v<T>, "remote elements are copied bytewise");
+public:
+    using value_type = RemoteElement<T>;
+    using iterator = detail::RemoteViewIterator<RemotePointerArray<T>>;
+public:
+    RemotePointerArray(const IProcessReader &reader, rptr_t data, size_t count,
+                       size_t chunk_size = RemoteContainerDefaultChunk,
+                       const CoalesceOptions &coalesce = CoalesceOptions())
+        : _pointers(reader, data, count, chunk_size), _reader(reader), _coalesce(coalesce), _chunk_size(std::max<size_t>(chunk_size, 1))
+    {}
+public:
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, _pointers.size()); }
+    inline size_t size() const noexcept { return _pointers.size(); }
+    inline bool ok() const noexcept { return _pointers.ok(); }
+public:
+    bool load(size_t index)
+    {
+        if (_loaded && index >= _chunk_first && index < _chunk_first + _chunk.size())
+            return true;
+        _loaded = false;
+        if (!_pointers.load(index))
+            return false;
+        _chunk_first = index / _chunk_size * _chunk_size;
+        size_t n = std::min(_chunk_size, _pointers.size() - _chunk_first);
+        _chunk.resize(n);
+        _requests.clear();
+        _request_elements.clear();
+        for (size_t i = 0; i < n; i++)
+        {
+            auto &element = _chunk[i];
+            element.address = _pointers.loaded(_chunk_first + i);
+            element.valid = element.address != rnullptr;
+            if (element.valid)
+            {
+                _requests.push_back(ReadRequest{ element.address, sizeof(T), &element.value, false });
+                _request_elements.push_back(i);
+            }
+        }
+        read_coalesced(_reader, _requests, _coalesce);
+        for (size_t i = 0; i < _requests.size(); i++)
+            _chunk[_request_elements[i]].valid = _requests[i].success;
+        _loaded = true;
+        return true;
+    }
+    inline const value_type &loaded(size_t index) const { return _chunk[index - _chunk_first]; }
+private:
+    RemoteArray<rptr_t> _pointers;
+    const IProcessReader &_reader;
+    CoalesceOptions _coalesce;
+    size_t _chunk_size;
+    std::vector<value_type> _chunk;
+    std::vector<ReadRequest> _requests;
+    std::vector<size_t> _request_elements;
+    size_t _chunk_first = 0;
+    bool _loaded = false;
+};
+
+/*
+A singly linked remote list, Next is the member holding the remote pointer to the next node.
+Nodes depend on each other so they are read one by one, max_length guards against cycles.
+*/
+template <class T, auto Next>
+class RemoteLinkedList
+{
+    static_assert(std::is_trivially_copyable_v<T>, "remote elements are copied bytewise");
+public:
+    using value_type = RemoteElement<T>;
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = RemoteElement<T>;
+        using difference_type = ptrdiff_t;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+    public:
+        iterator() = default;
+        iterator(const RemoteLinkedList *list, rptr_t head) : _list(list) { fetch(head); }
+    public:
+        reference operator*() const { return _node; }
+        pointer operator->() const { return &_node; }
+        iterator &operator++() { fetch((rptr_t)(_node.value.*Next)); return *this; }
+        void operator++(int) { ++*this; }
+        bool operator==(const iterator &rhs) const noexcept { return _node.address == rhs._node.address; }
+        bool operator!=(const iterator &rhs) const noexcept { return !(*this == rhs); }
+    private:
+        void fetch(rptr_t address)
+        {
+            _node.address = rnullptr;
+            _node.valid = false;
+            if (address == rnullptr || _list == nullptr || _visited++ >= _list->_max_length)
+                return;
+            if (_list->_reader.read_unsafe(address, sizeof(T), &_node.value))
+            {
+                _node.address = address;
+                _node.valid = true;
+            }
+        }
+    private:
+        const RemoteLinkedList *_list = nullptr;
+        value_type _node{ rnullptr, T{}, false };
+        size_t _visited = 0;
+    };
+public:
+    RemoteLinkedList(const IProcessReader &reader, rptr_t head, size_t max_length = 0x100000)
+        : _reader(reader), _head(head), _max_length(max_length)
+    {}
+public:
+    iterator begin() const { return iterator(this, _head); }
+    iterator end() const { return iterator(); }
+private:
+    const IProcessReader &_reader;
+    rptr_t _head;
+    size_t _max_length;
+};
+
+}
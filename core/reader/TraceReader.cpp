@@ -0,0 +1,132 @@
+#include "TraceReader.h"
+
+#include <algorithm>
+#include <string.h>
+#include <thread>
+
+namespace pkn
+{
+
+bool RecordingReader::read_unsafe(const erptr_t &address, size_t size, void *buffer) const
+{
+    using namespace std::chrono;
+    auto begin = steady_clock::now();
+    bool success = _reader->read_unsafe(address, size, buffer);
+    auto end = steady_clock::now();
+    _writer->append(address,
+                    size,
+                    (uint64_t)duration_cast<nanoseconds>(begin - _start).count(),
+                    (uint64_t)duration_cast<nanoseconds>(end - begin).count(),
+                    success,
+                    buffer);
+    return success;
+}
+
+bool RecordingReader::read_batch(ReadRequest *requests, size_t count) const
+{
+    using namespace std::chrono;
+    auto begin = steady_clock::now();
+    bool all_success = _reader->read_batch(requests, count);
+    auto end = steady_clock::now();
+    auto timestamp = (uint64_t)duration_cast<nanoseconds>(begin - _start).count();
+    auto latency = (uint64_t)duration_cast<nanoseconds>(end - begin).count();
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto &request = requests[i];
+        _writer->append(request.address, request.size, timestamp, latency, request.success, request.buffer);
+    }
+    return all_success;
+}
+
+ReplayReader::ReplayReader(const ReadTrace &trace, bool simulate_latency)
+    : _trace(trace), _simulate_latency(simulate_latency)
+{
+    const auto &records = _trace.records();
+    for (uint32_t i = 0; i < (uint32_t)records.size(); i++)
+    {
+        const auto &record = records[i];
+        _exact[Key{ record.address, record.size }].records.push_back(i);
+        if (record.success)
+            _by_address.push_back(i);
+    }
+    std::stable_sort(_by_address.begin(), _by_address.end(), [&](uint32_t lhs, uint32_t rhs)
+                     {
+                         return records[lhs].address < records[rhs].address;
+                     });
+}
+
+bool ReplayReader::read_unsafe(const erptr_t &address, size_t size, void *buffer) const
+{
+    auto begin = std::chrono::steady_clock::now();
+    uint64_t remote_address = address;
+    const ReadTraceRecord *record = nullptr;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        auto it = _exact.find(Key{ remote_address, size });
+        if (it != _exact.end())
+        {
+            auto &entry = it->second;
+            auto index = entry.records[std::min(entry.cursor, entry.records.size() - 1)];
+            if (entry.cursor < entry.records.size())
+                entry.cursor++;
+            record = &_trace.records()[index];
+        }
+    }
+
+    if (record != nullptr)
+    {
+        if (record->success)
+            memcpy(buffer, _trace.data(*record), size);
+    }
+    else if ((record = find_covering(remote_address, size)) != nullptr)
+    {
+        memcpy(buffer, _trace.data(*record) + (remote_address - record->address), size);
+    }
+    else
+    {
+        _misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (_simulate_latency)
+        wait_latency(begin, record->latency_ns);
+    return record->success;
+}
+
+void ReplayReader::rewind()
+{
+    std::lock_guard<std::mutex> l(_lock);
+    for (auto &p : _exact)
+        p.second.cursor = 0;
+}
+
+const ReadTraceRecord *ReplayReader::find_covering(uint64_t address, uint64_t size) const noexcept
+{
+    // records overlap, so walk back a bounded number of candidates starting below address
+    constexpr size_t max_candidates = 64;
+    const auto &records = _trace.records();
+    auto it = std::upper_bound(_by_address.begin(), _by_address.end(), address, [&](uint64_t a, uint32_t index)
+                               {
+                                   return a < records[index].address;
+                               });
+    for (size_t n = 0; it != _by_address.begin() && n < max_candidates; n++)
+    {
+        const auto &record = records[*--it];
+        if (record.address + record.size >= address + size)
+            return &record;
+    }
+    return nullptr;
+}
+
+void ReplayReader::wait_latency(std::chrono::steady_clock::time_point begin, uint64_t latency_ns) noexcept
+{
+    using namespace std::chrono;
+    auto deadline = begin + nanoseconds(latency_ns);
+    // sleeping is far too coarse for typical read latencies, only sleep for the long ones
+    if (latency_ns > 2000000)
+        std::this_thread::sleep_until(deadline - milliseconds(1));
+    while (steady_clock::now() < deadline)
+        std::this_thread::yield();
+}
+
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "../base/types.h"
+#include "../remote_process/IProcess.h"
+#include "ReadTrace.h"
+
+namespace pkn
+{
+
+// decorator that forwards every read and appends it to a trace
+class RecordingReader : public IProcessReader
+{
+public:
+    RecordingReader(IProcessReader *reader, ReadTraceWriter *writer)
+        : _reader(reader), _writer(writer), _start(std::chrono::steady_clock::now())
+    {}
+    virtual ~RecordingReader() override = default;
+public:
+    virtual bool read_unsafe(const erptr_t &address, size_t size, void *buffer) const override;
+    // forwarded as a batch, every request is recorded with the latency of the whole batch
+    virtual bool read_batch(ReadRequest *requests, size_t count) const override;
+private:
+    IProcessReader *_reader;
+    ReadTraceWriter *_writer;
+    std::chrono::steady_clock::time_point _start;
+};
+
+/*
+Serves reads from a recorded trace.
+A read is answered by the next unused record with the same (address, size), the last one repeats once they are used up.
+Reads never recorded with that exact shape are answered from any successful record covering the range.
+*/
+class ReplayReader : public IProcessReader
+{
+public:
+    ReplayReader(const ReadTrace &trace, bool simulate_latency = false);
+    virtual ~ReplayReader() override = default;
+public:
+    virtual bool read_unsafe(const erptr_t &address, size_t size, void *buffer) const override;
+public:
+    // rewind all (address, size) cursors to the beginning of the trace
+    void rewind();
+    // reads that could not be answered from the trace
+    inline uint64_t misses() const noexcept { return _misses.load(std::memory_order_relaxed); }
+    inline void set_simulate_latency(bool simulate) noexcept { _simulate_latency = simulate; }
+private:
+    struct Key
+    {
+        uint64_t address;
+        uint64_t size;
+        bool operator==(const Key &rhs) const noexcept { return address == rhs.address && size == rhs.size; }
+    };
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const noexcept { return (size_t)(key.address * 0x9E3779B97F4A7C15ull ^ key.size); }
+    };
+    struct Entry
+    {
+        std::vector<uint32_t> records;
+        size_t cursor = 0;
+    };
+private:
+    const ReadTraceRecord *find_covering(uint64_t address, uint64_t size) const noexcept;
+    static void wait_latency(std::chrono::steady_clock::time_point begin, uint64_t latency_ns) noexcept;
+private:
+    const ReadTrace &_trace;
+    bool _simulate_latency;
+    mutable std::mutex _lock;
+    mutable std::unordered_map<Key, Entry, KeyHash> _exact;
+    std::vector<uint32_t> _by_address; // successful records sorted by address
+    mutable std::atomic<uint64_t> _misses{ 0 };
+};
+
+}
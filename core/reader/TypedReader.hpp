@@ -5,6 +5,7 @@
 
 #include "../base/types.h"
 #include "../remote_process/IProcess.h"
+#include "FieldProjection.hpp"
 
 namespace pkn
 {
@@ -39,6 +40,17 @@ namespace pkn
             return _readable_process->read_unsafe(remote_address, sizeof(T) * number, seq_buffer);
         }
 
+        // read only the fields described by Projection(see FieldProjection.hpp), the rest of *buffer is zeroed
+        template <class Projection>
+        inline bool read_projected(erptr_t remote_address, typename Projection::type *buffer) const noexcept
+        {
+            rptr_t base = remote_address;
+            return Projection::read(buffer, [&](size_t offset, size_t size, void *local)
+                                    {
+                                        return _readable_process->read_unsafe(base + offset, size, local);
+                                    });
+        }
+
         // custom read rptr_t as type
         template <typename T>
         inline bool read_into(void *remote_address, T *buffer) const noexcept
@@ -62,6 +74,7 @@ namespace pkn
                 return false;
             return _readable_process->read_unsafe((rptr_t)remote_address, sizeof(T) * number, seq_buffer);
         }
+        inline IProcessReader &reader() const noexcept { return *_readable_process; }
     private:
         IProcessReader *_readable_process;
     };
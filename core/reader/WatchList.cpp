@@ -0,0 +1,190 @@
+#include "WatchList.h"
+
+#include <algorithm>
+#include <stdlib.h>
+
+namespace pkn
+{
+
+using namespace std::chrono;
+
+WatchList::WatchList(const IProcessReader &reader, double rate_hz, const CoalesceOptions &coalesce)
+    : _reader(reader), _coalesce(coalesce), _period_ns(0), _layout(std::make_shared<WatchLayout>())
+{
+    set_rate(rate_hz);
+}
+
+WatchList::~WatchList()
+{
+    stop();
+}
+
+watch_id_t WatchList::add(rptr_t address, size_t size)
+{
+    std::lock_guard<std::mutex> lock(_layout_lock);
+    auto layout = std::make_shared<WatchLayout>(*_layout);
+    layout->entries.push_back(WatchEntry{ address, size, layout->total_size });
+    layout->total_size += size;
+    _layout = std::move(layout);
+    _layout_dirty.store(true, std::memory_order_release);
+    return (watch_id_t)(_layout->entries.size() - 1);
+}
+
+void WatchList::clear()
+{
+    std::lock_guard<std::mutex> lock(_layout_lock);
+    _layout = std::make_shared<WatchLayout>();
+    _layout_dirty.store(true, std::memory_order_release);
+}
+
+void WatchList::set_rate(double rate_hz) noexcept
+{
+    rate_hz = std::clamp(rate_hz, 0.1, 10000.0);
+    _period_ns.store((int64_t)(1e9 / rate_hz), std::memory_order_relaxed);
+}
+
+bool WatchList::start()
+{
+    if (_running.exchange(true))
+        return false;
+    _thread = std::thread(&WatchList::run, this);
+    return true;
+}
+
+void WatchList::stop()
+{
+    if (!_running.exchange(false))
+        return;
+    if (_thread.joinable())
+        _thread.join();
+}
+
+void WatchList::sample_once()
+{
+    if (running())
+        return;
+    sample(steady_clock::now());
+}
+
+const WatchSnapshot &WatchList::latest() noexcept
+{
+    auto &snapshot = _snapshots.front();
+    if (!_snapshots.update())
+    {
+        // nothing new, what the caller saw last time is not a change anymore
+        std::fill(snapshot.changed.begin(), snapshot.changed.end(), 0);
+        return snapshot;
+    }
+
+    // the front slot belongs to the consumer now, changes are taken against the last sample it received,
+    // not the one published before, which the consumer may have skipped
+    auto &received = _snapshots.front();
+    size_t count = received.size();
+    size_t known = 0;
+    if (_received_layout != nullptr)
+        known = std::min(count, _received_layout->entries.size());
+    received.changed.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto &entry = received.layout->entries[i];
+        uint8_t valid = received.valid[i];
+        bool changed = valid != 0;
+        if (i < known)
+        {
+            // ids are reused after clear(), an entry is only compared with the same address and size
+            const auto &previous = _received_layout->entries[i];
+            if (previous.address == entry.address && previous.size == entry.size)
+            {
+                changed = valid != _received_valid[i]
+                    || (valid && memcmp(received.data.data() + entry.offset, _received.data() + previous.offset, entry.size) != 0);
+            }
+        }
+        received.changed[i] = changed ? 1 : 0;
+    }
+    _received_layout = received.layout;
+    _received = received.data;
+    _received_valid = received.valid;
+    return received;
+}
+
+WatchStatistics WatchList::statistics() const noexcept
+{
+    WatchStatistics statistics;
+    statistics.samples = _samples.load(std::memory_order_relaxed);
+    statistics.missed = _missed.load(std::memory_order_relaxed);
+    statistics.jitter_max_ns = _jitter_max_ns.load(std::memory_order_relaxed);
+    statistics.last_duration_ns = _last_duration_ns.load(std::memory_order_relaxed);
+    if (statistics.samples != 0)
+        statistics.jitter_mean_ns = _jitter_total_ns.load(std::memory_order_relaxed) / statistics.samples;
+    return statistics;
+}
+
+void WatchList::sample(steady_clock::time_point scheduled)
+{
+    auto begin = steady_clock::now();
+
+    if (_layout_dirty.exchange(false, std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(_layout_lock);
+        _sampled_layout = _layout;
+        _requests.resize(_sampled_layout->entries.size());
+    }
+    const auto &layout = *_sampled_layout;
+    size_t count = layout.entries.size();
+
+    auto &snapshot = _snapshots.back();
+    snapshot.layout = _sampled_layout;
+    snapshot.data.resize(layout.total_size);
+    snapshot.valid.resize(count);
+
+    // slots rotate, so buffers are pointed at the current back slot every time
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto &entry = layout.entries[i];
+        _requests[i] = ReadRequest{ entry.address, entry.size, snapshot.data.data() + entry.offset, false };
+    }
+    read_coalesced(_reader, _requests, _coalesce);
+
+    // changed is left to latest(), the consumer may skip this sample
+    for (size_t i = 0; i < count; i++)
+        snapshot.valid[i] = _requests[i].success ? 1 : 0;
+
+    auto end = steady_clock::now();
+    snapshot.sequence = ++_sequence;
+    snapshot.time = begin;
+    _snapshots.publish();
+
+    uint64_t jitter = (uint64_t)std::abs(duration_cast<nanoseconds>(begin - scheduled).count());
+    _samples.fetch_add(1, std::memory_order_relaxed);
+    _jitter_total_ns.fetch_add(jitter, std::memory_order_relaxed);
+    if (jitter > _jitter_max_ns.load(std::memory_order_relaxed))
+        _jitter_max_ns.store(jitter, std::memory_order_relaxed);
+    _last_duration_ns.store((uint64_t)duration_cast<nanoseconds>(end - begin).count(), std::memory_order_relaxed);
+}
+
+void WatchList::run()
+{
+    auto deadline = steady_clock::now();
+    while (_running.load(std::memory_order_relaxed))
+    {
+        auto spin_window = nanoseconds(_spin_window_ns.load(std::memory_order_relaxed));
+        std::this_thread::sleep_until(deadline - spin_window);
+        while (spin_window.count() > 0 && steady_clock::now() < deadline)
+            std::this_thread::yield();
+
+        sample(deadline);
+
+        // rates that can not be kept are skipped instead of sampled in a burst
+        auto period = nanoseconds(_period_ns.load(std::memory_order_relaxed));
+        deadline += period;
+        auto now = steady_clock::now();
+        if (now >= deadline)
+        {
+            auto behind = (now - deadline) / period + 1;
+            _missed.fetch_add((uint64_t)behind, std::memory_order_relaxed);
+            deadline += period * behind;
+        }
+    }
+}
+
+}
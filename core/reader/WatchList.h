@@ -0,0 +1,204 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "../base/noncopyable.h"
+#include "../base/types.h"
+#include "../remote_process/IProcess.h"
+#include "BatchReader.h"
+
+namespace pkn
+{
+
+/*
+Single producer, single consumer triple buffer.
+The producer fills back() and publish()es it, the consumer calls update() and reads front().
+Neither side ever blocks, and the consumer always sees a complete object.
+*/
+template <class T>
+class TripleBuffer
+{
+public:
+    // producer side
+    inline T &back() noexcept { return _slots[_back]; }
+    inline void publish() noexcept
+    {
+        _back = _middle.exchange(_back | Fresh, std::memory_order_acq_rel) & Index;
+    }
+
+    // consumer side, returns true if a newer object was published since the last update()
+    inline bool update() noexcept
+    {
+        if ((_middle.load(std::memory_order_relaxed) & Fresh) == 0)
+            return false;
+        _front = _middle.exchange(_front, std::memory_order_acq_rel) & Index;
+        return true;
+    }
+    inline const T &front() const noexcept { return _slots[_front]; }
+    inline T &front() noexcept { return _slots[_front]; }
+private:
+    constexpr static const uint8_t Index = 3;
+    constexpr static const uint8_t Fresh = 4;
+    T _slots[3];
+    alignas(64) uint8_t _back = 0;
+    alignas(64) std::atomic<uint8_t> _middle{ 1 };
+    alignas(64) uint8_t _front = 2;
+};
+
+using watch_id_t = uint32_t;
+
+struct WatchEntry
+{
+    rptr_t address;
+    size_t size;
+    size_t offset; // into WatchSnapshot::data
+};
+
+struct WatchLayout
+{
+    std::vector<WatchEntry> entries;
+    size_t total_size = 0;
+};
+
+// one complete sample of every watched entry
+class WatchSnapshot
+{
+public:
+    uint64_t sequence = 0; // 0 until the first sample is published
+    std::chrono::steady_clock::time_point time;
+    std::shared_ptr<const WatchLayout> layout;
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> valid;   // per entry, the read succeeded
+    std::vector<uint8_t> changed; // per entry, differs from the sample latest() returned before, skipped samples included
+public:
+    inline size_t size() const noexcept { return layout ? layout->entries.size() : 0; }
+    inline bool is_valid(watch_id_t id) const noexcept { return id < size() && valid[id]; }
+    inline bool has_changed(watch_id_t id) const noexcept { return id < size() && changed[id]; }
+    // nullptr if the entry is unknown to this sample or could not be read
+    inline const uint8_t *bytes(watch_id_t id) const noexcept
+    {
+        if (!is_valid(id))
+            return nullptr;
+        return &data[layout->entries[id].offset];
+    }
+    template <class T>
+    inline std::optional<T> get(watch_id_t id) const noexcept
+    {
+        auto p = bytes(id);
+        if (p == nullptr || layout->entries[id].size < sizeof(T))
+            return std::nullopt;
+        T v;
+        memcpy(&v, p, sizeof(T));
+        return v;
+    }
+};
+
+struct WatchStatistics
+{
+    uint64_t samples = 0;
+    // deadlines that passed before the previous sample finished
+    uint64_t missed = 0;
+    // distance between the scheduled and the actual start of a sample
+    uint64_t jitter_mean_ns = 0;
+    uint64_t jitter_max_ns = 0;
+    uint64_t last_duration_ns = 0;
+};
+
+/*
+Samples a set of remote addresses at a fixed rate on a dedicated thread.
+Every sample reads all entries with one coalesced batch and is published through a triple buffer,
+so the consumer never blocks the sampler and never sees a half written sample.
+latest() must only be called from one consumer thread; it compares each new sample with the one it
+returned before, so a consumer slower than the sampler still sees every change, and a sample returned
+again reports none.
+
+usage:
+@code
+WatchList watches(reader, 120.0);
+auto health = watches.add<float>(player + 0x140);
+auto bones = watches.add_range<FVector>(mesh + 0x400, 64);
+watches.start();
+...
+// render thread
+const auto &sample = watches.latest();
+if (sample.has_changed(health))
+    draw(*sample.get<float>(health));
+@endcode
+*/
+class WatchList : noncopyable
+{
+public:
+    WatchList(const IProcessReader &reader, double rate_hz = 60.0, const CoalesceOptions &coalesce = CoalesceOptions());
+    ~WatchList();
+public:
+    // entries may be added while the sampler runs, they show up from the next sample on
+    watch_id_t add(rptr_t address, size_t size);
+    template <class T>
+    inline watch_id_t add(rptr_t address) { return add(address, sizeof(T)); }
+    template <class T>
+    inline watch_id_t add_range(rptr_t address, size_t count) { return add(address, sizeof(T) * count); }
+    // drops every entry, ids are reused afterwards
+    void clear();
+
+    bool start();
+    void stop();
+    inline bool running() const noexcept { return _running.load(std::memory_order_relaxed); }
+    void set_rate(double rate_hz) noexcept;
+    inline double rate() const noexcept { return 1e9 / (double)_period_ns.load(std::memory_order_relaxed); }
+    /*
+    The scheduler wakes the sampler up late by up to a timer tick. A non zero window spins(yields) for that
+    last stretch before every deadline: less jitter, but a core stays busy for window * rate of each second.
+    0 by default, the sampler only sleeps.
+    */
+    inline void set_spin_window(std::chrono::nanoseconds window) noexcept { _spin_window_ns.store(std::max<int64_t>(window.count(), 0), std::memory_order_relaxed); }
+
+    // takes and publishes one sample on the calling thread, only when the sampler thread is not running
+    void sample_once();
+public:
+    // the newest published sample, its changed flags are relative to the previous call
+    const WatchSnapshot &latest() noexcept;
+    WatchStatistics statistics() const noexcept;
+private:
+    void sample(std::chrono::steady_clock::time_point scheduled);
+    void run();
+private:
+    const IProcessReader &_reader;
+    CoalesceOptions _coalesce;
+    std::atomic<int64_t> _period_ns;
+    std::atomic<int64_t> _spin_window_ns{ 0 };
+
+    std::mutex _layout_lock;
+    std::shared_ptr<const WatchLayout> _layout;
+    std::atomic<bool> _layout_dirty{ true };
+
+    // owned by the sampler
+    std::shared_ptr<const WatchLayout> _sampled_layout;
+    std::vector<ReadRequest> _requests;
+    uint64_t _sequence = 0;
+
+    // owned by the consumer, the sample latest() returned last
+    std::shared_ptr<const WatchLayout> _received_layout;
+    std::vector<uint8_t> _received;
+    std::vector<uint8_t> _received_valid;
+
+    TripleBuffer<WatchSnapshot> _snapshots;
+
+    std::atomic<bool> _running{ false };
+    std::thread _thread;
+
+    std::atomic<uint64_t> _samples{ 0 };
+    std::atomic<uint64_t> _missed{ 0 };
+    std::atomic<uint64_t> _jitter_total_ns{ 0 };
+    std::atomic<uint64_t> _jitter_max_ns{ 0 };
+    std::atomic<uint64_t> _last_duration_ns{ 0 };
+};
+
+}
@@ -10,71 +10,186 @@ void IProcessRegions::init()
     _retrive_memory_regions();
 }
 
-void IProcessRegions::refresh_regions()
+bool RegionDiff::affects(rptr_t address, size_t size) const noexcept
+{
+    auto overlaps = [&](const MemoryRegions &regions)
+    {
+        for (const auto &region : regions)
+        {
+            rptr_t base = region.base;
+            size_t region_size = region.size;
+            if (address < base + region_size && base < address + size)
+                return true;
+        }
+        return false;
+    };
+    return overlaps(added) || overlaps(removed) || overlaps(changed);
+}
+
+void IProcessRegions::reload_regions()
 {
     _clear_regions();
     _retrive_memory_regions();
 }
 
+static bool same_region(const MemoryRegion &lhs, const MemoryRegion &rhs) noexcept
+{
+    return (size_t)lhs.size == (size_t)rhs.size
+        && (size_t)lhs.protect == (size_t)rhs.protect
+        && lhs.type == rhs.type
+        && (rptr_t)lhs.allocation_base == (rptr_t)rhs.allocation_base;
+}
+
+RegionDiff IProcessRegions::refresh_regions()
+{
+    auto regions = get_all_memory_regions();
+    std::sort(regions.begin(), regions.end());
+
+    // both maps are sorted by base, walk them side by side
+    RegionDiff diff;
+    std::unordered_map<erptr_t, estr_t> mapped_file;
+    std::unordered_map<rptr_t, std::optional<estr_t>> allocation_names; // nullopt if the query failed
+    constexpr rptr_t exhausted = ~(rptr_t)0;
+    size_t i = 0, j = 0;
+    while (i < _regions.size() || j < regions.size())
+    {
+        rptr_t old_base = i < _regions.size() ? (rptr_t)_regions[i].base : exhausted;
+        rptr_t new_base = j < regions.size() ? (rptr_t)regions[j].base : exhausted;
+        if (old_base < new_base)
+        {
+            diff.removed.push_back(_regions[i++]);
+            continue;
+        }
+
+        const auto &region = regions[j++];
+        bool reuse_name = false;
+        if (old_base == new_base)
+        {
+            const auto &previous = _regions[i++];
+            if (same_region(previous, region))
+            {
+                reuse_name = true;
+            }
+            else
+            {
+                diff.changed.push_back(region);
+                reuse_name = previous.type == MEM_IMAGE && (rptr_t)previous.allocation_base == (rptr_t)region.allocation_base;
+            }
+        }
+        else
+        {
+            diff.added.push_back(region);
+        }
+
+        if (region.type != MEM_IMAGE)
+            continue;
+        if (reuse_name)
+        {
+            if (auto name = mapped_file_for_base(region.base))
+            {
+                mapped_file[region.base] = *name;
+                allocation_names.emplace((rptr_t)region.allocation_base, name);
+            }
+            continue;
+        }
+        // a newly loaded module brings one region per section, the remote query is made once per allocation
+        auto queried = allocation_names.find((rptr_t)region.allocation_base);
+        if (queried == allocation_names.end())
+        {
+            estr_t image_path;
+            std::optional<estr_t> name;
+            if (get_mapped_file(region.base, &image_path))
+                name = filename_for_path(image_path);
+            queried = allocation_names.emplace((rptr_t)region.allocation_base, std::move(name)).first;
+        }
+        if (queried->second)
+            mapped_file[region.base] = *queried->second;
+    }
+
+    _regions = std::move(regions);
+    _mapped_file = std::move(mapped_file);
+    _rebuild_index();
+    _module_index.build(_regions, _region_index, _mapped_file);
+    return diff;
+}
+
 MemoryRegions IProcessRegions::file_regions(const estr_t &executable_name) const
 {
-    auto regions = memory_regions();
     MemoryRegions results;
-    std::copy_if(regions.begin(), regions.end(), std::back_inserter(results), [&, this](const MemoryRegion &region)
-                 {
-                     if (auto res = mapped_file(region))
-                     {
-                         estr_t file = *res;
-                         file = filename_for_path(file);
-                         if (file == executable_name)
-                             return true;
-                     }
-                     return false;
-                 });
+    for (auto module : _module_index.find_all(ModuleIndex::hash_name(executable_name)))
+    {
+        if (!(module->name == executable_name))
+            continue;
+        for (auto i : module->regions)
+            results.push_back(_regions[i]);
+    }
     return results;
 }
 
 MemoryRegions IProcessRegions::file_regionsi(const estr_t &executable_name) const
 {
     auto ln = executable_name.to_lower();
-    auto regions = memory_regions();
     MemoryRegions results;
-    std::copy_if(regions.begin(), regions.end(), std::back_inserter(results), [&, this](const MemoryRegion &region)
-                 {
-                     if (auto res = mapped_file(region))
-                     {
-                         estr_t file = *res;
-                         file = filename_for_path(file).to_lower();
-                         if (file == ln)
-                             return true;
-                     }
-                     return false;
-                 });
+    for (auto module : _module_index.find_all(ModuleIndex::hash_name(executable_name)))
+    {
+        // the hash is case insensitive already, this only rules out collisions
+        if (!(module->name.to_lower() == ln))
+            continue;
+        for (auto i : module->regions)
+            results.push_back(_regions[i]);
+    }
     return results;
 }
+
 const MemoryRegions &IProcessRegions::memory_regions() const
 {
     return _regions;
 }
 
+const RegionIndex &IProcessRegions::region_index() const
+{
+    return _region_index;
+}
+
+const ModuleIndex &IProcessRegions::module_index() const
+{
+    return _module_index;
+}
+
+const MemoryRegions &IProcessRegions::_filtered_regions(size_t slot, uint8_t required_flags) const
+{
+    std::lock_guard<std::mutex> lock(_filtered_lock);
+    if (!_filtered_built[slot])
+    {
+        auto &filtered = _filtered[slot];
+        filtered.reserve(_region_index.count(required_flags));
+        _region_index.for_each(required_flags, [&](uint32_t i)
+                               {
+                                   filtered.push_back(_regions[i]);
+                               });
+        _filtered_built[slot] = true;
+    }
+    return _filtered[slot];
+}
+
 const MemoryRegions &IProcessRegions::readable_regions() const
 {
-    return _readable_regions;
+    return _filtered_regions(0, RegionReadable);
 }
 
 const MemoryRegions &IProcessRegions::readwritable_regions() const
 {
-    return _readwriteable_regions;
+    return _filtered_regions(1, RegionReadable | RegionWritable);
 }
 
 const pkn::MemoryRegions & IProcessRegions::readexecutable_regions() const
 {
-    return _readexecutable_regions;
+    return _filtered_regions(2, RegionReadable | RegionExecutable);
 }
 
 const pkn::MemoryRegions & IProcessRegions::readwritexecutable_regions() const
 {
-    return _readwritexecutable_regions;
+    return _filtered_regions(3, RegionReadable | RegionWritable | RegionExecutable);
 }
 
 std::optional<estr_t> IProcessRegions::mapped_file_for_address(const erptr_t &remote_address) const 
@@ -103,10 +218,10 @@ std::optional<estr_t> IProcessRegions::mapped_file(const MemoryRegion &region) c
 
 std::optional<pkn::MemoryRegion> IProcessRegions::region_for_address(const erptr_t &remote_address) const
 {
-    auto it = std::upper_bound(_regions.cbegin(), _regions.cend(), remote_address);
-    if (it != _regions.cbegin())
+    auto index = _region_index.predecessor(remote_address);
+    if (index != RegionIndex::NoRegion)
     {
-        return *(--it);
+        return _regions[index];
     }
     return std::nullopt;
 }
@@ -125,30 +240,33 @@ constexpr inline int msb(uint64_t val)
 void IProcessRegions::_clear_regions()
 {
     _regions.clear();
-    _readable_regions.clear();
-    _readwriteable_regions.clear();
-    _readexecutable_regions.clear();
-    _readwritexecutable_regions.clear();
+    _rebuild_index();
+    _module_index.clear();
     _mapped_file.clear();
 }
 
+// classifies every region once, the permission filtered lists are derived from the index on demand
+void IProcessRegions::_rebuild_index()
+{
+    _region_index.build(_regions);
+    std::lock_guard<std::mutex> lock(_filtered_lock);
+    for (size_t i = 0; i < 4; i++)
+    {
+        _filtered[i].clear();
+        _filtered_built[i] = false;
+    }
+}
+
 void IProcessRegions::_retrive_memory_regions()
 {
     this->_clear_regions();
     _regions = get_all_memory_regions();
     std::sort(_regions.begin(), _regions.end());
-    for (const auto &region : _regions)
+    _rebuild_index();
+    for (uint32_t i = 0; i < (uint32_t)_regions.size(); i++)
     {
-        if (region.readable())
-            _readable_regions.push_back(region);
-        if (region.readable() && region.writable())
-            _readwriteable_regions.push_back(region);
-        if (region.readable() && region.executable())
-            _readexecutable_regions.push_back(region);
-        if (region.readable() && region.writable() && region.executable())
-            _readwritexecutable_regions.push_back(region);
-
-        if (region.type == MEM_IMAGE)
+        const auto &region = _regions[i];
+        if (_region_index.has_flags(i, RegionImage))
         {
             estr_t image_path;
             if (get_mapped_file(region.base, &image_path))
@@ -158,6 +276,7 @@ void IProcessRegions::_retrive_memory_regions()
             }
         }
     }
+    _module_index.build(_regions, _region_index, _mapped_file);
 }
 
 void ProcessAddressTypeInfo::_retrive_memory_informations(IProcessBasic *_basic_process, IProcessRegions *_addressable_process)
@@ -1,6 +1,7 @@
 #pragma once
 #pragma once
 
+#include <mutex>
 #include <unordered_map>
 #include <optional>
 
@@ -8,11 +9,26 @@
 #include "../base/abstract/abstract.h"
 
 #include "MemoryRegion.h"
+#include "RegionIndex.h"
+#include "ModuleIndex.h"
 #include "IProcess.h"
 
 namespace pkn
 {
 
+// what changed between two snapshots of the region map
+struct RegionDiff
+{
+    MemoryRegions added;
+    MemoryRegions removed;
+    // regions whose base survived but whose size, protect or type changed, new state
+    MemoryRegions changed;
+public:
+    inline bool empty() const noexcept { return added.empty() && removed.empty() && changed.empty(); }
+    // [address, address + size) overlaps any added, removed or changed region
+    bool affects(rptr_t address, size_t size) const noexcept;
+};
+
 class IProcessRegions
 {
 public:
@@ -22,16 +38,28 @@ protected:
     virtual MemoryRegions get_all_memory_regions() PURE_VIRTUAL_FUNCTION_BODY;
     virtual bool get_mapped_file(erptr_t remote_address, estr_t *out_mapped_file) const PURE_VIRTUAL_FUNCTION_BODY;
 public:
-    void refresh_regions();
+    /*
+    re-walk the address space, unchanged regions keep their mapped file names,
+    get_mapped_file is only called for new or remapped image regions
+    */
+    RegionDiff refresh_regions();
+    // drop everything and retrieve all regions and mapped file names again
+    void reload_regions();
 public:
 
-    // case sensitive version
+    // image regions of the module, case sensitive version
     MemoryRegions file_regions(const estr_t &executable_name) const;
 
     // case insensitive version
     MemoryRegions file_regionsi(const estr_t &executable_name) const;
 
     const MemoryRegions &memory_regions() const;
+    // flat index over memory_regions(), prefer it for address lookups and permission checks
+    const RegionIndex &region_index() const;
+    // modules built from the image regions, rebuilt on every refresh
+    const ModuleIndex &module_index() const;
+
+    // built on first use from the flags of region_index()
     const MemoryRegions &readable_regions() const;
     const MemoryRegions &readwritable_regions() const;
     const MemoryRegions &readexecutable_regions() const;
@@ -55,16 +83,24 @@ public:
     */
     std::optional<estr_t> mapped_file(const MemoryRegion &region) const;
 
+    /*
+    return the last region whose base is not above the address
+    time complexity: O(log2(n))
+    */
     std::optional<MemoryRegion> region_for_address(const erptr_t &remote_address) const;
 private:
     void _clear_regions();
     void _retrive_memory_regions();
+    void _rebuild_index();
+    const MemoryRegions &_filtered_regions(size_t slot, uint8_t required_flags) const;
 private:
     MemoryRegions _regions;
-    MemoryRegions _readable_regions;
-    MemoryRegions _readwriteable_regions;
-    MemoryRegions _readexecutable_regions;
-    MemoryRegions _readwritexecutable_regions;
+    RegionIndex _region_index;
+    ModuleIndex _module_index;
+    // readable, readwritable, readexecutable, readwritexecutable
+    mutable std::mutex _filtered_lock;
+    mutable MemoryRegions _filtered[4];
+    mutable bool _filtered_built[4] = {};
     std::unordered_map<erptr_t, estr_t> _mapped_file;
 };
 
@@ -2,6 +2,9 @@
 #include "../base/types.h"
 #include "../base/abstract/abstract.h"
 
+#ifndef _Return_type_success_
+#define _Return_type_success_(expr)
+#endif
 typedef _Return_type_success_(return >= 0) long NTSTATUS;
 
 #ifndef PAGE_READONLY
@@ -42,12 +45,35 @@ public:
     virtual bool alive() const PURE_VIRTUAL_FUNCTION_BODY;
 };
 
+struct ReadRequest
+{
+    rptr_t address;
+    size_t size;
+    void *buffer;
+    bool success;
+};
+
 class IProcessReader
 {
 public:
     virtual ~IProcessReader() = default;
 public:
     virtual bool read_unsafe(const erptr_t &address, size_t size, void *buffer) const PURE_VIRTUAL_FUNCTION_BODY;
+
+    // fills success of every request, returns true only if all of them succeeded
+    // backends able to read several ranges in one round trip should override this, as KernelProcess does;
+    // the default reads the requests one by one
+    virtual bool read_batch(ReadRequest *requests, size_t count) const
+    {
+        bool all_success = true;
+        for (size_t i = 0; i < count; i++)
+        {
+            auto &request = requests[i];
+            request.success = read_unsafe(request.address, request.size, request.buffer);
+            all_success = all_success && request.success;
+        }
+        return all_success;
+    }
 };
 
 class IProcessWriter
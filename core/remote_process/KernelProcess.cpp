@@ -37,6 +37,17 @@ namespace pkn
         return driver().read_process_memory(pid(), address, size, buffer);
     }
 
+    bool KernelReadableProcess::read_batch(ReadRequest *requests, size_t count) const
+    {
+        std::vector<ReadProcessMemoriesData> datas(count);
+        for (size_t i = 0; i < count; i++)
+            datas[i] = ReadProcessMemoriesData{ requests[i].address, requests[i].size, requests[i].buffer, false };
+        bool all_success = driver().read_process_memories(pid(), count, datas.data());
+        for (size_t i = 0; i < count; i++)
+            requests[i].success = datas[i].success;
+        return all_success;
+    }
+
     bool KernelWritableProcess::write_unsafe(erptr_t address, size_t size, const void *buffer) const noexcept
     {
         return driver().write_process_memory(pid(), address, size, buffer);
@@ -59,6 +59,8 @@ namespace pkn
         virtual ~KernelReadableProcess() override = default;
     public:
         virtual bool read_unsafe(const erptr_t &address, size_t size, void *buffer) const noexcept override;
+        // one driver round trip for the whole batch
+        virtual bool read_batch(ReadRequest *requests, size_t count) const override;
     };
 
     class KernelWritableProcess : virtual public KernelProcessBase, virtual public IProcessWriter
@@ -15,6 +15,7 @@ public:
 
     bool writable() const noexcept
     {
+        size_t protect = this->protect;
         return protect == PAGE_WRITECOPY
             || protect == PAGE_WRITECOMBINE
             || protect == PAGE_READWRITE
@@ -28,6 +29,7 @@ public:
     }
     inline bool readable() const noexcept
     {
+        size_t protect = this->protect;
         return protect == PAGE_READONLY
             || protect == PAGE_READWRITE
             || protect == PAGE_EXECUTE_READ
@@ -35,6 +37,7 @@ public:
     }
     inline bool executable() const noexcept
     {
+        size_t protect = this->protect;
         return protect == PAGE_EXECUTE
             || protect == PAGE_EXECUTE_READ
             || protect == PAGE_EXECUTE_WRITECOPY
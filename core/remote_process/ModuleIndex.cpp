@@ -0,0 +1,159 @@
+#include "ModuleIndex.h"
+
+#include <algorithm>
+#include <string.h>
+
+namespace pkn
+{
+
+compile_time::hash_t ModuleIndex::hash_name(const estr_t &name) noexcept
+{
+    if (name.empty())
+        return 0;
+    return compile_time::run_time::hashi(&name.at(0), name.size());
+}
+
+void ModuleIndex::clear()
+{
+    _modules.clear();
+    _bases.clear();
+    _ends.clear();
+    _by_name.clear();
+    std::lock_guard<std::mutex> lock(_sections_lock);
+    _sections.clear();
+}
+
+void ModuleIndex::build(const MemoryRegions &regions, const RegionIndex &region_index, const std::unordered_map<erptr_t, estr_t> &mapped_files)
+{
+    clear();
+
+    // image regions of a module share their allocation base
+    std::unordered_map<rptr_t, uint32_t> by_allocation;
+    region_index.for_each(RegionImage, [&](uint32_t i)
+                          {
+                              const auto &region = regions[i];
+                              rptr_t allocation = region.allocation_base;
+                              if (allocation == rnullptr)
+                                  allocation = region_index.base(i);
+                              auto it = by_allocation.find(allocation);
+                              if (it == by_allocation.end())
+                              {
+                                  it = by_allocation.emplace(allocation, (uint32_t)_modules.size()).first;
+                                  ModuleRecord module;
+                                  module.base = allocation;
+                                  module.size = 0;
+                                  _modules.push_back(std::move(module));
+                              }
+                              auto &module = _modules[it->second];
+                              module.regions.push_back(i);
+                              module.size = std::max<size_t>(module.size, (size_t)(region_index.end(i) - module.base));
+                              if (module.name.empty())
+                              {
+                                  auto name = mapped_files.find(allocation);
+                                  if (name == mapped_files.end())
+                                      name = mapped_files.find(region.base);
+                                  if (name != mapped_files.end())
+                                      module.name = name->second;
+                              }
+                          });
+
+    std::sort(_modules.begin(), _modules.end(), [](const ModuleRecord &lhs, const ModuleRecord &rhs)
+              {
+                  return lhs.base < rhs.base;
+              });
+    _bases.reserve(_modules.size());
+    _ends.reserve(_modules.size());
+    for (uint32_t i = 0; i < (uint32_t)_modules.size(); i++)
+    {
+        auto &module = _modules[i];
+        module.name_hash = hash_name(module.name);
+        _bases.push_back(module.base);
+        _ends.push_back(module.end());
+        if (!module.name.empty())
+            _by_name.emplace(module.name_hash, i);
+    }
+}
+
+const ModuleRecord *ModuleIndex::find(compile_time::hash_t name_hash) const noexcept
+{
+    // a dll mapped more than once: the lowest base wins
+    const ModuleRecord *result = nullptr;
+    auto range = _by_name.equal_range(name_hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (result == nullptr || _modules[it->second].base < result->base)
+            result = &_modules[it->second];
+    }
+    return result;
+}
+
+const ModuleRecord *ModuleIndex::find(const estr_t &name) const noexcept
+{
+    return find(hash_name(name));
+}
+
+std::vector<const ModuleRecord *> ModuleIndex::find_all(compile_time::hash_t name_hash) const
+{
+    std::vector<const ModuleRecord *> result;
+    auto range = _by_name.equal_range(name_hash);
+    for (auto it = range.first; it != range.second; ++it)
+        result.push_back(&_modules[it->second]);
+    std::sort(result.begin(), result.end(), [](const ModuleRecord *lhs, const ModuleRecord *rhs)
+              {
+                  return lhs->base < rhs->base;
+              });
+    return result;
+}
+
+const ModuleRecord *ModuleIndex::module_for_address(rptr_t address) const noexcept
+{
+    auto it = std::upper_bound(_bases.begin(), _bases.end(), address);
+    if (it == _bases.begin())
+        return nullptr;
+    size_t i = (it - _bases.begin()) - 1;
+    if (address >= _ends[i])
+        return nullptr;
+    return &_modules[i];
+}
+
+const std::vector<ModuleSection> *ModuleIndex::sections(const ModuleRecord &module, const IProcessReader &reader) const
+{
+    std::lock_guard<std::mutex> lock(_sections_lock);
+    auto it = _sections.find(module.base);
+    if (it != _sections.end())
+        return it->second.get();
+
+    // IMAGE_DOS_HEADER::e_lfanew, then IMAGE_NT_HEADERS: Signature, IMAGE_FILE_HEADER, optional header
+    constexpr size_t LfanewOffset = 0x3C;
+    constexpr size_t FileHeaderOffset = 4;
+    constexpr size_t SectionHeaderSize = 40;
+    uint32_t lfanew = 0;
+    uint8_t file_header[20];
+    if (!reader.read_unsafe(module.base + LfanewOffset, sizeof(lfanew), &lfanew)
+        || !reader.read_unsafe(module.base + lfanew + FileHeaderOffset, sizeof(file_header), file_header))
+        return nullptr;
+    uint16_t number_of_sections, size_of_optional_header;
+    memcpy(&number_of_sections, file_header + 2, sizeof(uint16_t));
+    memcpy(&size_of_optional_header, file_header + 16, sizeof(uint16_t));
+
+    std::vector<uint8_t> headers(number_of_sections * SectionHeaderSize);
+    rptr_t first_section = module.base + lfanew + FileHeaderOffset + sizeof(file_header) + size_of_optional_header;
+    if (!headers.empty() && !reader.read_unsafe(first_section, headers.size(), headers.data()))
+        return nullptr;
+
+    auto sections = std::make_unique<std::vector<ModuleSection>>(number_of_sections);
+    for (size_t i = 0; i < number_of_sections; i++)
+    {
+        auto header = headers.data() + i * SectionHeaderSize;
+        auto &section = (*sections)[i];
+        memcpy(section.name, header, sizeof(section.name));
+        memcpy(&section.virtual_size, header + 8, sizeof(uint32_t));
+        memcpy(&section.virtual_address, header + 12, sizeof(uint32_t));
+        memcpy(&section.characteristics, header + 36, sizeof(uint32_t));
+    }
+    auto result = sections.get();
+    _sections.emplace(module.base, std::move(sections));
+    return result;
+}
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "../base/types.h"
+#include "../base/compile_time/hash.hpp"
+#include "MemoryRegion.h"
+#include "RegionIndex.h"
+#include "IProcess.h"
+
+namespace pkn
+{
+
+struct ModuleSection
+{
+    char name[8]; // not null terminated if 8 characters long
+    uint32_t virtual_address;
+    uint32_t virtual_size;
+    uint32_t characteristics;
+};
+
+struct ModuleRecord
+{
+    estr_t name;                       // file name, without the path
+    compile_time::hash_t name_hash;    // compile_time::hashi of name
+    rptr_t base;
+    size_t size;                       // from base to the end of the last region of the module
+    std::vector<uint32_t> regions;     // indexes into the region list the index was built from
+public:
+    inline rptr_t end() const noexcept { return base + size; }
+    inline bool contains(rptr_t address) const noexcept { return address >= base && address - base < size; }
+};
+
+/*
+Modules(MEM_IMAGE allocations) of a process, built once per region refresh.
+Names are looked up by their case insensitive hash, addresses by a binary search over sorted module intervals,
+and module lists are handed out by reference.
+
+usage:
+@code
+auto &modules = process.module_index();
+if (auto ntdll = modules.find(compile_time::hashi(L"ntdll.dll")))
+    ...;
+if (auto module = modules.module_for_address(rip))
+    printf("%ws+%llx\n", module->name.to_wstring().c_str(), rip - module->base);
+@endcode
+*/
+class ModuleIndex
+{
+public:
+    void build(const MemoryRegions &regions, const RegionIndex &region_index, const std::unordered_map<erptr_t, estr_t> &mapped_files);
+    void clear();
+public:
+    inline const std::vector<ModuleRecord> &modules() const noexcept { return _modules; }
+    inline size_t size() const noexcept { return _modules.size(); }
+
+    // first module with this name, nullptr if none; name_hash is compile_time::hashi of the file name
+    const ModuleRecord *find(compile_time::hash_t name_hash) const noexcept;
+    const ModuleRecord *find(const estr_t &name) const noexcept;
+    // every module with this name, a dll can be mapped more than once
+    std::vector<const ModuleRecord *> find_all(compile_time::hash_t name_hash) const;
+
+    const ModuleRecord *module_for_address(rptr_t address) const noexcept;
+
+    /*
+    section table of a module, parsed from its remote headers on first use
+    nullptr if the headers could not be read
+    */
+    const std::vector<ModuleSection> *sections(const ModuleRecord &module, const IProcessReader &reader) const;
+public:
+    static compile_time::hash_t hash_name(const estr_t &name) noexcept;
+private:
+    std::vector<ModuleRecord> _modules; // sorted by base
+    std::vector<rptr_t> _bases;
+    std::vector<rptr_t> _ends;
+    std::unordered_multimap<compile_time::hash_t, uint32_t> _by_name;
+
+    mutable std::mutex _sections_lock;
+    mutable std::unordered_map<rptr_t, std::unique_ptr<std::vector<ModuleSection>>> _sections;
+};
+
+}
@@ -0,0 +1,121 @@
+#include "RegionIndex.h"
+
+#include <algorithm>
+
+namespace pkn
+{
+
+uint8_t region_flags(const MemoryRegion &region) noexcept
+{
+    size_t protect = region.protect;
+    uint8_t flags = 0;
+    switch (protect)
+    {
+    case PAGE_READONLY:
+        flags = RegionReadable;
+        break;
+    case PAGE_READWRITE:
+        flags = RegionReadable | RegionWritable;
+        break;
+    case PAGE_EXECUTE_READ:
+        flags = RegionReadable | RegionExecutable;
+        break;
+    case PAGE_EXECUTE_READWRITE:
+        flags = RegionReadable | RegionWritable | RegionExecutable;
+        break;
+    case PAGE_WRITECOPY:
+    case PAGE_WRITECOMBINE:
+        flags = RegionWritable;
+        break;
+    case PAGE_EXECUTE:
+        flags = RegionExecutable;
+        break;
+    case PAGE_EXECUTE_WRITECOPY:
+        flags = RegionWritable | RegionExecutable;
+        break;
+    default:
+        break;
+    }
+    if (region.type == MEM_IMAGE)
+        flags |= RegionImage;
+    return flags;
+}
+
+void RegionIndex::clear()
+{
+    _bases.clear();
+    _ends.clear();
+    _flags.clear();
+    _tree.assign(1, ~(rptr_t)0);
+    _tree_rank.assign(1, 0);
+    _depth = 0;
+}
+
+void RegionIndex::build(const MemoryRegions &regions)
+{
+    clear();
+    _bases.reserve(regions.size());
+    _ends.reserve(regions.size());
+    _flags.reserve(regions.size());
+    for (const auto &region : regions)
+    {
+        rptr_t base = region.base;
+        size_t size = region.size;
+        _bases.push_back(base);
+        _ends.push_back(base + size);
+        _flags.push_back(region_flags(region));
+    }
+
+    while (((size_t)1 << _depth) - 1 < _bases.size())
+        _depth++;
+    size_t nodes = ((size_t)1 << _depth) - 1;
+    _tree.assign(nodes + 1, ~(rptr_t)0);
+    _tree_rank.assign(nodes + 1, (uint32_t)_bases.size());
+    fill_tree(0, 1);
+}
+
+// in-order walk of the implicit tree assigns the sorted bases, slots past the end keep the padding
+size_t RegionIndex::fill_tree(size_t sorted_index, size_t k)
+{
+    if (k >= _tree.size())
+        return sorted_index;
+    sorted_index = fill_tree(sorted_index, 2 * k);
+    if (sorted_index < _bases.size())
+    {
+        _tree[k] = _bases[sorted_index];
+        _tree_rank[k] = (uint32_t)sorted_index;
+    }
+    sorted_index++;
+    return fill_tree(sorted_index, 2 * k + 1);
+}
+
+void RegionIndex::find_batch(const rptr_t *addresses, size_t count, uint32_t *indices) const noexcept
+{
+    constexpr size_t Lanes = 8;
+    size_t k[Lanes];
+    for (size_t first = 0; first < count; first += Lanes)
+    {
+        size_t lanes = std::min(Lanes, count - first);
+        auto batch = addresses + first;
+        for (size_t lane = 0; lane < lanes; lane++)
+            k[lane] = 1;
+        for (uint32_t level = 0; level < _depth; level++)
+            for (size_t lane = 0; lane < lanes; lane++)
+                k[lane] = 2 * k[lane] + (_tree[k[lane]] <= batch[lane]);
+        for (size_t lane = 0; lane < lanes; lane++)
+        {
+            auto index = predecessor_of_leaf(k[lane]);
+            indices[first + lane] = index != NoRegion && batch[lane] < _ends[index] ? index : NoRegion;
+        }
+    }
+}
+
+size_t RegionIndex::count(uint8_t required_flags) const noexcept
+{
+    size_t n = 0;
+    for (auto flags : _flags)
+        n += (flags & required_flags) == required_flags;
+    return n;
+}
+
+}
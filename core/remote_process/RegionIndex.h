@@ -0,0 +1,131 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "../base/types.h"
+#include "MemoryRegion.h"
+
+namespace pkn
+{
+
+enum RegionFlag : uint8_t
+{
+    RegionReadable = 1,
+    RegionWritable = 2,
+    RegionExecutable = 4,
+    RegionImage = 8,
+};
+
+// classification of a region, protect is decrypted only once
+uint8_t region_flags(const MemoryRegion &region) noexcept;
+
+/*
+Compact, read only index over sorted memory regions.
+Bases, ends and permission flags are plain integer columns, and address lookups run over
+a copy of the bases in Eytzinger(BFS) order: a fixed number of branch free steps,
+and the top levels every lookup goes through share a few cache lines.
+
+usage:
+@code
+RegionIndex index;
+index.build(regions); // regions sorted by base
+if (index.contains(pointer, RegionReadable | RegionWritable))
+    ...;
+std::vector<uint32_t> found(pointers.size());
+index.find_batch(pointers.data(), pointers.size(), found.data());
+@endcode
+*/
+class RegionIndex
+{
+public:
+    constexpr static const uint32_t NoRegion = 0xFFFFFFFF;
+public:
+    // regions must be sorted by base and must not overlap
+    void build(const MemoryRegions &regions);
+    void clear();
+public:
+    inline size_t size() const noexcept { return _bases.size(); }
+    inline bool empty() const noexcept { return _bases.empty(); }
+    inline rptr_t base(uint32_t index) const noexcept { return _bases[index]; }
+    // exclusive
+    inline rptr_t end(uint32_t index) const noexcept { return _ends[index]; }
+    inline uint8_t flags(uint32_t index) const noexcept { return _flags[index]; }
+    inline bool has_flags(uint32_t index, uint8_t required_flags) const noexcept { return (_flags[index] & required_flags) == required_flags; }
+
+    // index of the last region whose base <= address, NoRegion if there is none
+    inline uint32_t predecessor(rptr_t address) const noexcept
+    {
+        size_t k = 1;
+        for (uint32_t level = 0; level < _depth; level++)
+            k = 2 * k + (_tree[k] <= address);
+        return predecessor_of_leaf(k);
+    }
+    // index of the region containing address, NoRegion if there is none
+    inline uint32_t find(rptr_t address) const noexcept
+    {
+        auto index = predecessor(address);
+        if (index == NoRegion || address >= _ends[index])
+            return NoRegion;
+        return index;
+    }
+    // the lookups of a batch are interleaved, so their cache misses overlap
+    void find_batch(const rptr_t *addresses, size_t count, uint32_t *indices) const noexcept;
+
+    inline bool contains(rptr_t address, uint8_t required_flags = 0) const noexcept
+    {
+        auto index = find(address);
+        return index != NoRegion && has_flags(index, required_flags);
+    }
+    // [address, address + size) lies in one region
+    inline bool contains_range(rptr_t address, size_t size, uint8_t required_flags = 0) const noexcept
+    {
+        auto index = find(address);
+        return index != NoRegion && has_flags(index, required_flags) && size <= _ends[index] - address;
+    }
+
+    // f(index) for every region having all of required_flags, in address order
+    template <class F>
+    void for_each(uint8_t required_flags, F f) const
+    {
+        for (uint32_t i = 0; i < (uint32_t)_flags.size(); i++)
+            if (has_flags(i, required_flags))
+                f(i);
+    }
+    size_t count(uint8_t required_flags) const noexcept;
+private:
+    static inline uint32_t trailing_ones(uint64_t value) noexcept
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, ~value);
+        return index;
+#else
+        return (uint32_t)__builtin_ctzll(~value);
+#endif
+    }
+    // k is the leaf reached after _depth steps
+    inline uint32_t predecessor_of_leaf(size_t k) const noexcept
+    {
+        // strip the trailing right turns, the node left of them is the first base > address
+        k >>= trailing_ones(k) + 1;
+        uint32_t upper_bound = k == 0 ? (uint32_t)_bases.size() : _tree_rank[k];
+        return upper_bound == 0 ? NoRegion : upper_bound - 1;
+    }
+    size_t fill_tree(size_t sorted_index, size_t k);
+private:
+    std::vector<rptr_t> _bases;
+    std::vector<rptr_t> _ends;
+    std::vector<uint8_t> _flags;
+
+    // 1-based complete tree of 2^_depth - 1 bases, padded with ~0, _tree[0] is unused
+    std::vector<rptr_t> _tree;
+    std::vector<uint32_t> _tree_rank; // sorted index of every tree node
+    uint32_t _depth = 0;
+};
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <thread>
 #include <mutex>
@@ -7,8 +8,10 @@
 #include "../remote_process/IProcess.h"
 #include "../remote_process/IAddressableProcess.h"
 #include "../injector/injector.hpp"
+#include "../session/Session.h"
 
 #include "SearchType.h"
+#include "ScanPlan.h"
 
 namespace pkn
 {
@@ -24,11 +27,68 @@ enum class SeekMemoryRegionSource
     ReadWriteExecute
 };
 
+// scan one input, returns true once enough results are found
+template <bool find_all,
+    size_t padding,
+    int align,
+    class TestFunc>
+    bool seek_input(
+        const IProcessReader &process,
+        TestFunc &test_func,
+        const Input &input,
+        std::vector<uint8_t> &buffer,
+        Outputs &outputs,
+        std::atomic<size_t> &number_to_seek
+    )
+{
+    bool finished = false;
+    try
+    {
+        size_t size_required = input.size + padding + 8;
+        if (buffer.size() < size_required)
+            buffer.resize(size_required);
+        process.read_unsafe(input.base, input.size, &buffer[0]);
+        try
+        {
+            // try to read padding
+            process.read_unsafe(input.base + input.size, padding, (char *)(&buffer[0]) + input.size);
+        }
+        catch (const std::exception&)
+        {
+        }
+        auto local_start = &buffer[0];
+        for (uint8_t *local_address = local_start; local_address < (local_start + input.size) && !finished; local_address += align)
+        {
+            if constexpr (!find_all)
+                if (number_to_seek == 0) { finished = true; break; }
+
+            try
+            {
+                uint64_t remote_address = input.base + (local_address - local_start);
+                if (test_func(local_address, remote_address))
+                {
+                    outputs.push_back(remote_address);
+                    if constexpr (!find_all)
+                        if (--number_to_seek == 0) { finished = true; break; }
+                }
+            }
+            catch (const std::exception&)
+            {
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+    }
+    return finished;
+}
+
 template <bool find_all,
     size_t padding,
     int align,
     class TestFunc>
     void thread_seek_memory(
+        const IProcessReader &process,
         TestFunc test_func,
         std::mutex &input_mutex,
         Inputs &inputs,
@@ -37,7 +97,6 @@ template <bool find_all,
         std::atomic<size_t> &number_to_seek
     )
 {
-    auto &process = SingletonInjector<IProcessReader>::get();
     Outputs my_ouputs;
     std::vector<uint8_t> buffer(0x10240);
     bool finished = false;
@@ -51,47 +110,67 @@ template <bool find_all,
             input = inputs.back();
             inputs.pop_back();
         }
-        try
+        finished = seek_input<find_all, padding, align>(process, test_func, input, buffer, my_ouputs, number_to_seek);
+    }
+    std::lock_guard<std::mutex> l(output_mutex);
+    outputs.insert(outputs.end(), my_ouputs.begin(), my_ouputs.end());
+}
+
+// workers take the chunks of a plan in address order through a shared cursor, the plan itself is never modified
+template <bool find_all,
+    size_t padding,
+    int align,
+    class TestFunc>
+    void thread_seek_plan(
+        const IProcessReader &process,
+        TestFunc test_func,
+        const ScanPlan &plan,
+        std::atomic<size_t> &next_chunk,
+        std::mutex &output_mutex,
+        Outputs &outputs,
+        std::atomic<size_t> &number_to_seek
+    )
+{
+    Outputs my_ouputs;
+    std::vector<uint8_t> buffer(plan.criteria().chunk_size + padding + 8);
+    const auto &chunks = plan.chunks();
+    for (size_t i = next_chunk++; i < chunks.size(); i = next_chunk++)
+    {
+        if (seek_input<find_all, padding, align>(process, test_func, chunks[i], buffer, my_ouputs, number_to_seek))
+            break;
+    }
+    std::lock_guard<std::mutex> l(output_mutex);
+    outputs.insert(outputs.end(), my_ouputs.begin(), my_ouputs.end());
+}
+
+// split regions into inputs for nparts workers
+template <int offset,
+    int align,
+    size_t max_offset_to_seek>
+    Inputs make_seek_inputs(const MemoryRegions &regions, size_t nparts)
+{
+    Inputs inputs;
+    constexpr size_t aligned_limit = (max_offset_to_seek + align - 1) / align * align;
+    for (const auto region : regions)
+    {
+        // split data
+        if constexpr (max_offset_to_seek == 0)
         {
-            size_t size_required = input.size + padding + 8;
-            if (buffer.size() < size_required)
-                buffer.resize(size_required);
-            process.read_unsafe(input.base, input.size, &buffer[0]);
-            try
+            size_t size_per_thread = ((region.size - offset) / nparts + align - 1) / align * align;
+            for (size_t i = 0; i < nparts; i++)
             {
-                // try to read padding
-                process.read_unsafe(input.base + input.size, padding, (char *)(&buffer[0]) + input.size);
-            }
-            catch (const std::exception&)
-            {
-            }
-            auto local_start = &buffer[0];
-            for (uint8_t *local_address = local_start; local_address < (local_start + input.size) && !finished; local_address += align)
-            {
-                if constexpr (!find_all)
-                    if (number_to_seek == 0) { finished = true; break; }
-
-                try
-                {
-                    uint64_t remote_address = input.base + (local_address - local_start);
-                    if (test_func(local_address, remote_address))
-                    {
-                        my_ouputs.push_back(remote_address);
-                        if constexpr (!find_all)
-                            if (--number_to_seek == 0) { finished = true; break; }
-                    }
-                }
-                catch (const std::exception&)
-                {
-                }
+                Input input{ region.base + size_per_thread * i + offset, size_per_thread };
+                inputs.push_back(input);
             }
         }
-        catch (const std::exception&)
+        else
         {
+            size_t size_per_thread = region.size - offset < aligned_limit - offset ? region.size - offset : aligned_limit - offset;
+            Input input{ region.base + offset, size_per_thread };
+            inputs.push_back(input);
         }
     }
-    std::lock_guard<std::mutex> l(output_mutex);
-    outputs.insert(outputs.end(), my_ouputs.begin(), my_ouputs.end());
+    return inputs;
 }
 
 template <size_t reserve_size,
@@ -106,8 +185,8 @@ template <size_t reserve_size,
         int nthread = 0)
 {
     //constexpr size_t padding = reserve_size + align + offset; // supply this to template argument is not supported ???
+    auto &process = SingletonInjector<IProcessReader>::get();
     std::mutex input_mutex;
-    Inputs inputs;
 
     if (nthread == 0)
     {
@@ -120,26 +199,7 @@ template <size_t reserve_size,
     Outputs results;
 
     // prepare input data for worker thread
-    constexpr size_t aligned_limit = (max_offset_to_seek + align - 1) / align * align;
-    for (const auto region : regions)
-    {
-        // split data
-        if constexpr (max_offset_to_seek == 0)
-        {
-            size_t size_per_thread = ((region.size - offset) / nthread + align - 1) / align * align;
-            for (size_t i = 0; i < nthread; i++)
-            {
-                Input input{ region.base + size_per_thread * i + offset, size_per_thread };
-                inputs.push_back(input);
-            }
-        }
-        else
-        {
-            size_t size_per_thread = region.size - offset < aligned_limit - offset ? region.size - offset : aligned_limit - offset;
-            Input input{ region.base + offset, size_per_thread };
-            inputs.push_back(input);
-        }
-    }
+    Inputs inputs = make_seek_inputs<offset, align, max_offset_to_seek>(regions, nthread);
 
     // spawn worker thread
     std::vector<std::thread> ths;
@@ -149,7 +209,7 @@ template <size_t reserve_size,
             break;
         ths.emplace_back([&]()
                          {
-                             thread_seek_memory<number_to_seek == -1, reserve_size + align + offset, align>(test_func, input_mutex, inputs, output_mutex, results, atomic_number_to_seek);
+                             thread_seek_memory<number_to_seek == -1, reserve_size + align + offset, align>(process, test_func, input_mutex, inputs, output_mutex, results, atomic_number_to_seek);
                          }
         );
     }
@@ -161,23 +221,52 @@ template <size_t reserve_size,
     return results;
 }
 
+/*
+same as above, but reads through the session's reader and runs on the session's WorkQueue,
+so scans of several sessions share one WorkerPool without touching SingletonInjector
+*/
 template <size_t reserve_size,
     int number_to_seek = -1,
-    bool heap = true, // if heap is false, ignore regions seems located at heap
-    SeekMemoryRegionSource source = SeekMemoryRegionSource::ReadWrite,
     int offset = 0,
     int align = 8,
-    size_t minimun_region_size = 0x1000,
     size_t max_offset_to_seek = 0,
-    class TestFunc,
-    class RegionFilterFunc = DefaultRegionFilter>
-    seek_results_t seek_memory(TestFunc test_func,
-                              int nthread = 0,
-                              RegionFilterFunc extra_region_filter = DefaultRegionFilter())
+    class TestFunc>
+    seek_results_t seek_regions(
+        Session &session,
+        const MemoryRegions &regions,
+        TestFunc test_func)
 {
-    auto &pr = SingletonInjector<IProcessRegions>::get();
-    auto &address_type_judger = SingletonInjector<ProcessAddressTypeInfo>::get();
+    std::mutex input_mutex;
+    size_t nparts = session.parallelism();
 
+    std::atomic<size_t> atomic_number_to_seek = number_to_seek;
+    std::mutex output_mutex;
+    Outputs results;
+
+    Inputs inputs = make_seek_inputs<offset, align, max_offset_to_seek>(regions, nparts);
+
+    auto &process = session.reader();
+    for (size_t i = 0; i < nparts; i++)
+    {
+        session.queue().submit([&]()
+                               {
+                                   thread_seek_memory<number_to_seek == -1, reserve_size + align + offset, align>(process, test_func, input_mutex, inputs, output_mutex, results, atomic_number_to_seek);
+                               }
+        );
+    }
+    session.queue().wait();
+    results.erase(std::unique(results.begin(), results.end()), results.end());
+    return results;
+}
+
+template <bool heap,
+    SeekMemoryRegionSource source,
+    size_t minimun_region_size,
+    class RegionFilterFunc>
+    MemoryRegions select_seek_regions(const IProcessRegions &pr,
+                                      const ProcessAddressTypeInfo &address_type_judger,
+                                      RegionFilterFunc &extra_region_filter)
+{
     const MemoryRegions *pregions = nullptr;
     if constexpr (source == SeekMemoryRegionSource::ReadOnly)
         pregions = &pr.readable_regions();
@@ -202,9 +291,119 @@ template <size_t reserve_size,
                 continue;
         regions_selected.push_back(region);
     }
+    return regions_selected;
+}
+
+template <size_t reserve_size,
+    int number_to_seek = -1,
+    bool heap = true, // if heap is false, ignore regions seems located at heap
+    SeekMemoryRegionSource source = SeekMemoryRegionSource::ReadWrite,
+    int offset = 0,
+    int align = 8,
+    size_t minimun_region_size = 0x1000,
+    size_t max_offset_to_seek = 0,
+    class TestFunc,
+    class RegionFilterFunc = DefaultRegionFilter>
+    seek_results_t seek_memory(TestFunc test_func,
+                              int nthread = 0,
+                              RegionFilterFunc extra_region_filter = DefaultRegionFilter())
+{
+    auto &pr = SingletonInjector<IProcessRegions>::get();
+    auto &address_type_judger = SingletonInjector<ProcessAddressTypeInfo>::get();
+    auto regions_selected = select_seek_regions<heap, source, minimun_region_size>(pr, address_type_judger, extra_region_filter);
     return seek_regions<reserve_size, number_to_seek, offset, align, max_offset_to_seek>(regions_selected, test_func, nthread);
 }
 
+template <size_t reserve_size,
+    int number_to_seek = -1,
+    bool heap = true, // if heap is false, ignore regions seems located at heap
+    SeekMemoryRegionSource source = SeekMemoryRegionSource::ReadWrite,
+    int offset = 0,
+    int align = 8,
+    size_t minimun_region_size = 0x1000,
+    size_t max_offset_to_seek = 0,
+    class TestFunc,
+    class RegionFilterFunc = DefaultRegionFilter>
+    seek_results_t seek_memory(Session &session,
+                              TestFunc test_func,
+                              RegionFilterFunc extra_region_filter = DefaultRegionFilter())
+{
+    auto regions_selected = select_seek_regions<heap, source, minimun_region_size>(session.regions(), session.address_info(), extra_region_filter);
+    return seek_regions<reserve_size, number_to_seek, offset, align, max_offset_to_seek>(session, regions_selected, test_func);
+}
+
+/*
+scan every chunk of a prebuilt plan, nothing is filtered, copied or split per call
+results are sorted, as chunks are taken in address order but finish in any order
+*/
+template <size_t reserve_size,
+    int number_to_seek = -1,
+    int align = 8,
+    class TestFunc>
+    seek_results_t seek_plan(
+        const ScanPlan &plan,
+        TestFunc test_func,
+        int nthread = 0)
+{
+    auto &process = SingletonInjector<IProcessReader>::get();
+
+    if (nthread == 0)
+    {
+        nthread = std::thread::hardware_concurrency() - 1;
+        nthread = nthread == 0 ? 1 : nthread;
+    }
+
+    std::atomic<size_t> atomic_number_to_seek = number_to_seek;
+    std::atomic<size_t> next_chunk = 0;
+    std::mutex output_mutex;
+    Outputs results;
+
+    std::vector<std::thread> ths;
+    for (int i = 0; i < nthread && (size_t)i < plan.chunks().size(); i++)
+    {
+        ths.emplace_back([&]()
+                         {
+                             thread_seek_plan<number_to_seek == -1, reserve_size + align, align>(process, test_func, plan, next_chunk, output_mutex, results, atomic_number_to_seek);
+                         }
+        );
+    }
+    for (auto &th : ths)
+    {
+        th.join();
+    }
+    std::sort(results.begin(), results.end());
+    results.erase(std::unique(results.begin(), results.end()), results.end());
+    return results;
+}
 
+template <size_t reserve_size,
+    int number_to_seek = -1,
+    int align = 8,
+    class TestFunc>
+    seek_results_t seek_plan(
+        Session &session,
+        const ScanPlan &plan,
+        TestFunc test_func)
+{
+    std::atomic<size_t> atomic_number_to_seek = number_to_seek;
+    std::atomic<size_t> next_chunk = 0;
+    std::mutex output_mutex;
+    Outputs results;
 
+    auto &process = session.reader();
+    size_t nparts = std::min(session.parallelism(), plan.chunks().size());
+    for (size_t i = 0; i < nparts; i++)
+    {
+        session.queue().submit([&]()
+                               {
+                                   thread_seek_plan<number_to_seek == -1, reserve_size + align, align>(process, test_func, plan, next_chunk, output_mutex, results, atomic_number_to_seek);
+                               }
+        );
+    }
+    session.queue().wait();
+    std::sort(results.begin(), results.end());
+    results.erase(std::unique(results.begin(), results.end()), results.end());
+    return results;
 }
+
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "ScanPlan.h"
+
+#include <algorithm>
+
+namespace pkn
+{
+
+ScanPlan ScanPlan::build(const IProcessRegions &regions, const ProcessAddressTypeInfo &address_info, const ScanCriteria &criteria)
+{
+    ScanPlan plan;
+    plan._criteria = criteria;
+    if (plan._criteria.chunk_size < 0x1000)
+        plan._criteria.chunk_size = 0x1000;
+    plan._criteria.chunk_size &= ~(size_t)0xFFF;
+
+    const auto &index = regions.region_index();
+    auto modules = plan.selected_modules(regions);
+
+    rptr_t pending_base = rnullptr;
+    size_t pending_size = 0;
+    for (uint32_t i = 0; i < (uint32_t)index.size(); i++)
+    {
+        rptr_t base = index.base(i);
+        size_t size = index.end(i) - base;
+        if (!plan.selects(index.flags(i), base, size, modules, address_info))
+            continue;
+
+        if (criteria.coalesce && pending_size != 0 && pending_base + pending_size == base)
+        {
+            pending_size += size;
+            continue;
+        }
+        if (pending_size != 0)
+            plan.add_range(pending_base, pending_size);
+        pending_base = base;
+        pending_size = size;
+    }
+    if (pending_size != 0)
+        plan.add_range(pending_base, pending_size);
+
+    plan.cut_chunks();
+    return plan;
+}
+
+void ScanPlan::add_range(rptr_t base, size_t size)
+{
+    _bases.push_back(base);
+    _sizes.push_back(size);
+    _total_size += size;
+}
+
+void ScanPlan::cut_chunks()
+{
+    auto chunk_size = _criteria.chunk_size;
+    _chunks.reserve(_total_size / chunk_size + _bases.size());
+    for (size_t i = 0; i < _bases.size(); i++)
+    {
+        for (size_t offset = 0; offset < _sizes[i]; offset += chunk_size)
+            _chunks.push_back(Input{ _bases[i] + offset, std::min(chunk_size, _sizes[i] - offset) });
+    }
+}
+
+std::vector<const ModuleRecord *> ScanPlan::selected_modules(const IProcessRegions &regions) const
+{
+    if (_criteria.module == 0)
+        return {};
+    return regions.module_index().find_all(_criteria.module);
+}
+
+bool ScanPlan::selects(uint8_t flags, rptr_t base, size_t size,
+                       const std::vector<const ModuleRecord *> &modules,
+                       const ProcessAddressTypeInfo &address_info) const
+{
+    if ((flags & _criteria.required_flags) != _criteria.required_flags || (flags & _criteria.excluded_flags) != 0)
+        return false;
+    if (size < _criteria.minimum_region_size)
+        return false;
+    if (_criteria.module != 0 && std::none_of(modules.begin(), modules.end(), [&](const ModuleRecord *module) { return module->contains(base); }))
+        return false;
+    if (_criteria.heap != ScanHeapClass::Any && address_info.seems_heap_address(base) != (_criteria.heap == ScanHeapClass::HeapOnly))
+        return false;
+    return true;
+}
+
+bool ScanPlan::affected_by(const RegionDiff &diff, const IProcessRegions &regions, const ProcessAddressTypeInfo &address_info) const
+{
+    auto overlaps = [&](const MemoryRegions &list)
+    {
+        for (const auto &region : list)
+        {
+            rptr_t base = region.base;
+            size_t size = region.size;
+            // the last range starting before the end of the region
+            auto it = std::lower_bound(_bases.begin(), _bases.end(), base + size);
+            if (it == _bases.begin())
+                continue;
+            size_t i = (it - _bases.begin()) - 1;
+            if (base < _bases[i] + _sizes[i])
+                return true;
+        }
+        return false;
+    };
+    // a new region, or one changed into a match, the criteria would select is missing from the plan
+    auto modules = selected_modules(regions);
+    auto selected = [&](const MemoryRegions &list)
+    {
+        for (const auto &region : list)
+        {
+            if (selects(region_flags(region), (rptr_t)region.base, (size_t)region.size, modules, address_info))
+                return true;
+        }
+        return false;
+    };
+    if (selected(diff.added) || selected(diff.changed))
+        return true;
+    return overlaps(diff.removed) || overlaps(diff.changed);
+}
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "../base/types.h"
+#include "../base/compile_time/hash.hpp"
+#include "../remote_process/RegionIndex.h"
+#include "../remote_process/IAddressableProcess.h"
+
+#include "SearchType.h"
+
+namespace pkn
+{
+
+enum class ScanHeapClass
+{
+    Any,
+    HeapOnly,
+    NoHeap, // ignore regions seems located at heap
+};
+
+struct ScanCriteria
+{
+    uint8_t required_flags = RegionReadable | RegionWritable; // RegionFlag bits every region must have
+    uint8_t excluded_flags = 0;                               // RegionFlag bits no region may have
+    size_t minimum_region_size = 0x1000;                      // applied to every region, before coalescing
+    ScanHeapClass heap = ScanHeapClass::Any;
+    compile_time::hash_t module = 0;                          // if not 0, only regions of the modules of this name(compile_time::hashi)
+    bool coalesce = true;                                     // merge adjacent selected regions into one range
+    size_t chunk_size = 0x100000;                             // ranges are cut into chunks of at most this size, a multiple of 0x1000
+};
+
+/*
+Immutable list of the address ranges a scan has to cover, built once from the flag columns of
+the region index and reused by every scan over the same criteria.
+Selected regions that touch each other are coalesced into one range, so a match straddling
+two regions is not missed and a scan issues fewer, larger reads.
+Ranges are stored as plain base/size columns and pre cut into chunks, which workers take
+in order through an atomic cursor, no filtering, copying or splitting is left to a scan.
+
+A plan is a snapshot: rebuild it when refresh_regions() reports a diff affecting it.
+
+usage:
+@code
+ScanCriteria criteria;
+criteria.heap = ScanHeapClass::NoHeap;
+auto plan = ScanPlan::build(process, process, criteria);
+for (;;)
+{
+    auto results = seek_plan<8>(plan, [](uint8_t *p, uint64_t) { return ...; });
+    auto diff = process.refresh_regions();
+    if (plan.affected_by(diff, process, process))
+        plan = ScanPlan::build(process, process, criteria);
+}
+@endcode
+*/
+class ScanPlan
+{
+public:
+    static ScanPlan build(const IProcessRegions &regions, const ProcessAddressTypeInfo &address_info, const ScanCriteria &criteria);
+public:
+    inline const ScanCriteria &criteria() const noexcept { return _criteria; }
+
+    inline size_t size() const noexcept { return _bases.size(); }
+    inline bool empty() const noexcept { return _bases.empty(); }
+    inline rptr_t base(size_t index) const noexcept { return _bases[index]; }
+    inline size_t range_size(size_t index) const noexcept { return _sizes[index]; }
+    inline const std::vector<rptr_t> &bases() const noexcept { return _bases; }
+    inline const std::vector<size_t> &sizes() const noexcept { return _sizes; }
+    // bytes covered by the plan
+    inline size_t total_size() const noexcept { return _total_size; }
+
+    inline const Inputs &chunks() const noexcept { return _chunks; }
+
+    /*
+    the diff removed or changed a region under the plan, or added or changed one into a region the
+    criteria would select; regions and address_info are the refreshed state the diff came from
+    */
+    bool affected_by(const RegionDiff &diff, const IProcessRegions &regions, const ProcessAddressTypeInfo &address_info) const;
+private:
+    // modules of the criteria in the current module index, empty if the criteria have no module
+    std::vector<const ModuleRecord *> selected_modules(const IProcessRegions &regions) const;
+    // the test build() applies to every region, affected_by() to the regions of a diff
+    bool selects(uint8_t flags, rptr_t base, size_t size,
+                 const std::vector<const ModuleRecord *> &modules,
+                 const ProcessAddressTypeInfo &address_info) const;
+    void add_range(rptr_t base, size_t size);
+    void cut_chunks();
+private:
+    ScanCriteria _criteria;
+    std::vector<rptr_t> _bases; // sorted
+    std::vector<size_t> _sizes;
+    size_t _total_size = 0;
+    Inputs _chunks;
+};
+
+}
@@ -0,0 +1,93 @@
+#include "Session.h"
+
+#include <thread>
+
+namespace pkn
+{
+
+Session::Session(const std::string &name,
+                 std::shared_ptr<void> owner,
+                 IProcessBasic &basic,
+                 IProcessReader &reader,
+                 IProcessRegions &regions,
+                 ProcessAddressTypeInfo &address_info,
+                 std::shared_ptr<WorkQueue> queue)
+    : _name(name),
+    _owner(std::move(owner)),
+    _basic(basic),
+    _reader(&reader),
+    _regions(regions),
+    _address_info(address_info),
+    _typed_reader(std::make_unique<TypedReader>(&reader)),
+    _queue(std::move(queue))
+{
+    set_parallelism(std::thread::hardware_concurrency());
+}
+
+void Session::set_reader(IProcessReader *reader)
+{
+    _reader = reader;
+    _typed_reader = std::make_unique<TypedReader>(reader);
+    _owned_reader.reset();
+}
+
+void Session::adopt_reader(std::unique_ptr<IProcessReader> reader)
+{
+    set_reader(reader.get());
+    _owned_reader = std::move(reader);
+}
+
+void Session::clear_caches()
+{
+    std::lock_guard<std::mutex> lock(_cache_lock);
+    _caches.clear();
+}
+
+Session &SessionManager::add(std::unique_ptr<Session> session)
+{
+    std::unique_ptr<Session> replaced;
+    Session *added = session.get();
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        auto &slot = _sessions[session->name()];
+        replaced = std::move(slot);
+        slot = std::move(session);
+    }
+    if (replaced)
+        replaced->queue().wait();
+    return *added;
+}
+
+bool SessionManager::detach(const std::string &name)
+{
+    std::unique_ptr<Session> session;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        auto it = _sessions.find(name);
+        if (it == _sessions.end())
+            return false;
+        session = std::move(it->second);
+        _sessions.erase(it);
+    }
+    // let running scans of the session drain before it goes away
+    session->queue().wait();
+    return true;
+}
+
+Session *SessionManager::find(const std::string &name) const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    auto it = _sessions.find(name);
+    return it == _sessions.end() ? nullptr : it->second.get();
+}
+
+std::vector<Session *> SessionManager::sessions() const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    std::vector<Session *> result;
+    for (const auto &p : _sessions)
+        result.push_back(p.second.get());
+    return result;
+}
+
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+#include "../base/noncopyable.h"
+#include "../base/types.h"
+#include "../remote_process/IProcess.h"
+#include "../remote_process/IAddressableProcess.h"
+#include "../reader/TypedReader.hpp"
+#include "WorkerPool.h"
+
+namespace pkn
+{
+
+/*
+Everything needed to analyse one target process, without going through SingletonInjector.
+A session owns its process object, its reader and its caches, and schedules its scans
+on a WorkQueue of a WorkerPool shared with the other sessions.
+
+usage:
+@code
+WorkerPool pool;
+SessionManager sessions(pool);
+auto &game = sessions.attach("game", std::make_shared<KernelProcess>(game_pid), 4);
+auto &launcher = sessions.attach("launcher", std::make_shared<KernelProcess>(launcher_pid), 1);
+auto results = seek_memory<8>(game, [](uint8_t *p, uint64_t) { return ...; });
+@endcode
+*/
+class Session : noncopyable
+{
+public:
+    Session(const std::string &name,
+            std::shared_ptr<void> owner,
+            IProcessBasic &basic,
+            IProcessReader &reader,
+            IProcessRegions &regions,
+            ProcessAddressTypeInfo &address_info,
+            std::shared_ptr<WorkQueue> queue);
+    virtual ~Session() = default;
+
+    // Process must implement every process interface a session needs, as KernelProcess does
+    template <class Process>
+    static std::unique_ptr<Session> from_process(const std::string &name, std::shared_ptr<Process> process, WorkerPool &pool, uint32_t priority = 1)
+    {
+        auto &p = *process;
+        return std::make_unique<Session>(name, std::move(process), p, p, p, p, pool.create_queue(priority));
+    }
+public:
+    inline const std::string &name() const noexcept { return _name; }
+    inline IProcessBasic &process() const noexcept { return _basic; }
+    inline IProcessReader &reader() const noexcept { return *_reader; }
+    inline TypedReader &typed_reader() const noexcept { return *_typed_reader; }
+    inline IProcessRegions &regions() const noexcept { return _regions; }
+    inline ProcessAddressTypeInfo &address_info() const noexcept { return _address_info; }
+    inline WorkQueue &queue() const noexcept { return *_queue; }
+    // scans of this session are split into this many parts
+    inline size_t parallelism() const noexcept { return _parallelism; }
+    inline void set_parallelism(size_t parallelism) noexcept { _parallelism = parallelism == 0 ? 1 : parallelism; }
+
+    // swaps the reader used by the session, e.g. for an InstrumentedReader or a RecordingReader
+    void set_reader(IProcessReader *reader);
+    // same as above, the session owns the reader
+    void adopt_reader(std::unique_ptr<IProcessReader> reader);
+
+    /*
+    Per session cache slot, one T per session, default constructed on first use.
+    Lets indexes and caches built on top of a session live exactly as long as the session.
+    */
+    template <class T>
+    T &cache()
+    {
+        std::lock_guard<std::mutex> lock(_cache_lock);
+        auto &slot = _caches[std::type_index(typeid(T))];
+        if (!slot)
+            slot = std::make_shared<T>();
+        return *static_cast<T *>(slot.get());
+    }
+    void clear_caches();
+private:
+    std::string _name;
+    std::shared_ptr<void> _owner;
+    IProcessBasic &_basic;
+    IProcessReader *_reader;
+    std::unique_ptr<IProcessReader> _owned_reader;
+    IProcessRegions &_regions;
+    ProcessAddressTypeInfo &_address_info;
+    std::unique_ptr<TypedReader> _typed_reader;
+    std::shared_ptr<WorkQueue> _queue;
+    size_t _parallelism;
+
+    std::mutex _cache_lock;
+    std::map<std::type_index, std::shared_ptr<void>> _caches;
+};
+
+// named sessions sharing one WorkerPool
+class SessionManager : noncopyable
+{
+public:
+    explicit SessionManager(WorkerPool &pool) : _pool(pool) {}
+public:
+    // replaces any session with the same name
+    template <class Process>
+    Session &attach(const std::string &name, std::shared_ptr<Process> process, uint32_t priority = 1)
+    {
+        return add(Session::from_process(name, std::move(process), _pool, priority));
+    }
+    Session &add(std::unique_ptr<Session> session);
+    bool detach(const std::string &name);
+    // nullptr if no such session
+    Session *find(const std::string &name) const;
+    std::vector<Session *> sessions() const;
+    inline WorkerPool &pool() const noexcept { return _pool; }
+private:
+    WorkerPool &_pool;
+    mutable std::mutex _lock;
+    std::map<std::string, std::unique_ptr<Session>> _sessions;
+};
+
+}
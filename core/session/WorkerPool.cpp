@@ -0,0 +1,151 @@
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+namespace pkn
+{
+
+WorkQueue::WorkQueue(WorkerPool &pool, uint32_t weight)
+    : _pool(pool), _weight(std::max<uint32_t>(weight, 1))
+{}
+
+void WorkQueue::set_weight(uint32_t weight) noexcept
+{
+    std::lock_guard<std::mutex> lock(_pool._lock);
+    _weight = std::max<uint32_t>(weight, 1);
+}
+
+void WorkQueue::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_pool._lock);
+        // a queue waking up from idle starts at the current virtual time, it can not claim the time it slept
+        if (_tasks.empty() && _running == 0)
+            _pass = std::max(_pass, _pool._virtual_time);
+        _tasks.push_back(std::move(task));
+    }
+    _pool._has_work.notify_one();
+}
+
+void WorkQueue::wait()
+{
+    std::unique_lock<std::mutex> lock(_pool._lock);
+    while (true)
+    {
+        if (!_tasks.empty())
+        {
+            std::function<void()> task;
+            _pool.pop(*this, task);
+            lock.unlock();
+            WorkerPool::execute(task);
+            lock.lock();
+            finish_one();
+            continue;
+        }
+        if (_running == 0)
+            return;
+        _idle.wait(lock);
+    }
+}
+
+// caller holds the pool lock
+void WorkQueue::finish_one()
+{
+    --_running;
+    if (_running == 0 && _tasks.empty())
+        _idle.notify_all();
+}
+
+WorkerPool::WorkerPool(size_t threads)
+{
+    if (threads == 0)
+    {
+        // hardware_concurrency() may be 0 when it is not computable
+        size_t hardware = std::thread::hardware_concurrency();
+        threads = std::max<size_t>(hardware, 2) - 1;
+    }
+    for (size_t i = 0; i < threads; i++)
+        _threads.emplace_back(&WorkerPool::run, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _stopping = true;
+    }
+    _has_work.notify_all();
+    for (auto &thread : _threads)
+        thread.join();
+}
+
+std::shared_ptr<WorkQueue> WorkerPool::create_queue(uint32_t weight)
+{
+    std::shared_ptr<WorkQueue> queue(new WorkQueue(*this, weight));
+    std::lock_guard<std::mutex> lock(_lock);
+    queue->_pass = _virtual_time;
+    _queues.push_back(queue);
+    return queue;
+}
+
+void WorkerPool::pop(WorkQueue &queue, std::function<void()> &task)
+{
+    task = std::move(queue._tasks.front());
+    queue._tasks.pop_front();
+    ++queue._running;
+    _virtual_time = std::max(_virtual_time, queue._pass);
+    queue._pass += Stride / queue._weight;
+}
+
+bool WorkerPool::take(std::function<void()> &task, std::shared_ptr<WorkQueue> &queue)
+{
+    queue.reset();
+    for (size_t i = 0; i < _queues.size();)
+    {
+        auto candidate = _queues[i].lock();
+        if (!candidate)
+        {
+            _queues[i] = _queues.back();
+            _queues.pop_back();
+            continue;
+        }
+        if (!candidate->_tasks.empty() && (!queue || candidate->_pass < queue->_pass))
+            queue = std::move(candidate);
+        i++;
+    }
+    if (!queue)
+        return false;
+    pop(*queue, task);
+    return true;
+}
+
+void WorkerPool::execute(std::function<void()> &task) noexcept
+{
+    try
+    {
+        task();
+    }
+    catch (...)
+    {
+    }
+}
+
+void WorkerPool::run()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    while (true)
+    {
+        std::function<void()> task;
+        std::shared_ptr<WorkQueue> queue;
+        _has_work.wait(lock, [&]() { return _stopping || take(task, queue); });
+        if (!queue)
+            return;
+        lock.unlock();
+        execute(task);
+        task = nullptr;
+        lock.lock();
+        queue->finish_one();
+    }
+}
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../base/noncopyable.h"
+
+namespace pkn
+{
+
+class WorkerPool;
+
+/*
+A queue of tasks scheduled on a shared WorkerPool.
+Queues are served in proportion to their weight: a queue of weight 4 gets about four times
+the task slots of a queue of weight 1 while both have work, and an idle queue costs nothing.
+*/
+class WorkQueue : noncopyable
+{
+    friend class WorkerPool;
+public:
+    void submit(std::function<void()> task);
+    // runs pending tasks of this queue on the calling thread until all of them are finished,
+    // so it may be called from a worker without deadlocking the pool
+    void wait();
+public:
+    inline uint32_t weight() const noexcept { return _weight; }
+    void set_weight(uint32_t weight) noexcept;
+private:
+    WorkQueue(WorkerPool &pool, uint32_t weight);
+    void finish_one();
+private:
+    WorkerPool &_pool;
+    uint32_t _weight;
+    uint64_t _pass = 0; // stride scheduling, the queue with the lowest pass runs next
+    std::deque<std::function<void()>> _tasks;
+    size_t _running = 0;
+    std::condition_variable _idle;
+};
+
+class WorkerPool : noncopyable
+{
+    friend class WorkQueue;
+public:
+    // 0 threads: one less than the number of hardware threads
+    explicit WorkerPool(size_t threads = 0);
+    ~WorkerPool();
+public:
+    // queues must not outlive their pool
+    std::shared_ptr<WorkQueue> create_queue(uint32_t weight = 1);
+    inline size_t size() const noexcept { return _threads.size(); }
+private:
+    void run();
+    // picks the next task, caller holds _lock
+    bool take(std::function<void()> &task, std::shared_ptr<WorkQueue> &queue);
+    // pops the front task of queue and charges it one stride, caller holds _lock
+    void pop(WorkQueue &queue, std::function<void()> &task);
+    static void execute(std::function<void()> &task) noexcept;
+private:
+    constexpr static const uint64_t Stride = 1 << 20;
+    std::mutex _lock;
+    std::condition_variable _has_work;
+    std::vector<std::weak_ptr<WorkQueue>> _queues;
+    std::vector<std::thread> _threads;
+    uint64_t _virtual_time = 0; // pass of the last scheduled queue
+    bool _stopping = false;
+};
+
+}
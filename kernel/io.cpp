@@ -83,14 +83,6 @@ NTSTATUS IoDispatchSlow(
 
         switch (stack->Parameters.DeviceIoControl.IoControlCode)
         {
-        //case IOCTL_PLAYERKNOWNS_READ_PROCESS_MEMORIES:
-        //{
-        //    CHECK_VARIADIC_INPUT_LENGTH(ReadProcessMemories);
-        //    DecryptInputByXor();
-        //    status = read_process_memories(pin->processid, pin->count, pdata);
-        //    bytesIO = 0;
-        //    break;
-        //}
         case IOCTL_PLAYERKNOWNS_WRITE_PROCESS_MEMORY:
         {
             CHECK_INPUT_LENGTH(WriteProcessMemory);
@@ -654,6 +646,28 @@ NTSTATUS IoDispatch(
             break;
         }
 
+        // read several ranges of one process in one round trip
+        case IOCTL_PLAYERKNOWNS_READ_PROCESS_MEMORIES:
+        {
+            CHECK_VARIADIC_INPUT_LENGTH(ReadProcessMemories);
+            if (outlength != inlength)
+            {
+                status = STATUS_INVALID_PARAMETER;
+                break;
+            }
+            DecryptInputByXor();
+            UINT64 count = (inlength - sizeof(ReadProcessMemoriesInputHead)) / sizeof(ReadProcessMemoriesInputData);
+            if (pin->count != count)
+            {
+                status = STATUS_INVALID_PARAMETER;
+                break;
+            }
+            status = read_process_memories(pin->processid, count, pdata, __xor_val);
+            XorMemory(pdata, count * sizeof(ReadProcessMemoriesInputData), __xor_val);
+            bytesIO = inlength;
+            break;
+        }
+
         // acquire a spin lock
         case IOCTL_PLAYERKNOWNS_ACQUIRE_LOCK:
         {
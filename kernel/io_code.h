@@ -87,19 +87,20 @@ typedef struct __ReadProcessMemoryInput
     UINT64 buffer;
 }ReadProcessMemoryInput;
 
-//// RPMs
-//typedef struct __ReadProcessMemoriesInputData
-//{
-//    UINT64 startaddress;
-//    UINT64 bytestoread;
-//    UINT64 buffer;
-//}ReadProcessMemoriesInputData;
-//typedef struct __ReadProcessMemoriesInputHead
-//{
-//    UINT64 xor_val;
-//    UINT64 processid;
-//    UINT64 count;
-//}ReadProcessMemoriesInputHead;
+// RPMs, the output is the input buffer with succeeded filled
+typedef struct __ReadProcessMemoriesInputData
+{
+    UINT64 startaddress;
+    UINT64 bytestoread;
+    UINT64 buffer;
+    UINT64 succeeded;
+}ReadProcessMemoriesInputData;
+typedef struct __ReadProcessMemoriesInputHead
+{
+    UINT64 xor_val;
+    UINT64 processid;
+    UINT64 count;
+}ReadProcessMemoriesInputHead;
 
 // WPM
 typedef struct __WriteProcessMemoryInput
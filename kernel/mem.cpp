@@ -136,21 +136,28 @@ NTSTATUS read_process_memory(UINT64 processid, UINT64 address, SIZE_T size, UINT
     return mm_copy_virtual_memory(processid, address, size, buffer);
 }
 
-//NTSTATUS read_process_memories(UINT64 processid, SIZE_T count, const ReadProcessMemoriesInputData *datas)
-//{
-//    NTSTATUS status = STATUS_SUCCESS;
-//    int full_sucess = TRUE;
-//    for (int i = 0; i < count; i++)
-//    {
-//        const ReadProcessMemoriesInputData *pd = &datas[i];
-//        status = read_process_memory(processid, pd->startaddress, pd->bytestoread, pd->buffer);
-//        if (!NT_SUCCESS(status))
-//            full_sucess = FALSE;
-//    }
-//    if(full_sucess)
-//        return status;
-//    return STATUS_PARTIAL_COPY;
-//}
+NTSTATUS read_process_memories(UINT64 processid, SIZE_T count, ReadProcessMemoriesInputData *datas, UINT64 xor_val)
+{
+    // the process is looked up once for the whole batch
+    PEPROCESS peprocess;
+    NTSTATUS status = PsLookupProcessByProcessId((HANDLE)processid, &peprocess);
+    if (!NT_SUCCESS(status))
+        return status;
+    for (SIZE_T i = 0; i < count; i++)
+    {
+        ReadProcessMemoriesInputData *pd = &datas[i];
+        SIZE_T ncopy;
+        NTSTATUS copy_status = MmCopyVirtualMemory(peprocess, (PVOID)pd->startaddress, PsGetCurrentProcess(), (PVOID)pd->buffer, pd->bytestoread, UserMode, &ncopy);
+        pd->succeeded = NT_SUCCESS(copy_status) ? 1 : 0;
+        if (pd->succeeded)
+        {
+            for (SIZE_T j = 0; j + 8 <= pd->bytestoread; j += 8)
+                *(UINT64 *)((char *)pd->buffer + j) ^= xor_val;
+        }
+    }
+    ObDereferenceObject(peprocess);
+    return STATUS_SUCCESS;
+}
 
 NTSTATUS write_process_memory(UINT64 processid, UINT64 address, SIZE_T size, UINT64 buffer)
 {
@@ -114,7 +114,8 @@ extern "C"
 
 NTSTATUS read_process_memory(UINT64 processid, UINT64 address, SIZE_T size, UINT64 buffer);
 
-//NTSTATUS read_process_memories(UINT64 processid, SIZE_T count, const ReadProcessMemoriesInputData * datas);
+// fills succeeded of every data, buffers that were read are xored with xor_val like the single read does
+NTSTATUS read_process_memories(UINT64 processid, SIZE_T count, ReadProcessMemoriesInputData *datas, UINT64 xor_val);
 
 NTSTATUS write_process_memory(UINT64 processid, UINT64 address, SIZE_T size, UINT64 buffer);
 
@@ -7,6 +7,8 @@
 #include <pkn/core/remote_process/KernelProcess.h>
 #include <pkn/core/remote_process/KernelProcessUtils.h>
 #include <pkn/core/reader/TypedReader.hpp>
+#include <pkn/core/reader/ReadInstrumentation.h>
+#include <pkn/core/session/Session.h>
 #include <pkn/core/writer/TypedWriter.hpp>
 
 #define INIT(func_name) if(!func_name()) {printf("[-] failed to intialize function: %s\n", #func_name); return false;}
@@ -75,7 +77,8 @@ protected:
             {
                 pkn::SingletonInjector<KernelProcess>::set(process);
                 pkn::SingletonInjector<IProcessBasic>::set(process);
-                pkn::SingletonInjector<IProcessReader>::set(process);
+                reader = instrument_reader(process, "KernelProcess");
+                pkn::SingletonInjector<IProcessReader>::set(reader);
                 pkn::SingletonInjector<IProcessWriter>::set(process);
                 pkn::SingletonInjector<IProcessRegions>::set(process);
                 pkn::SingletonInjector<IProcessExtra>::set(process);
@@ -83,7 +86,7 @@ protected:
                 pkn::SingletonInjector<IProcessThread>::set(process);
                 pkn::SingletonInjector<ProcessAddressTypeInfo>::set(process);
 
-                auto tr = new TypedReader(process);
+                auto tr = new TypedReader(reader);
                 pkn::SingletonInjector<TypedReader>::set(tr);
                 auto tw = new TypedWriter(process);
                 pkn::SingletonInjector<TypedWriter>::set(tw);
@@ -98,6 +101,34 @@ public:
     pkn::KernelProcessUtils *process_utils = nullptr;
     pkn::PknDriver *driver = nullptr;
     pkn::KernelProcess *process = nullptr;
+    pkn::IProcessReader *reader = nullptr; // process itself, or its InstrumentedReader
 };
 
+/*
+Attaches a session to another process without touching SingletonInjector,
+so several processes can be analysed at once. The driver must already be set up(see Environment::init_driver).
+usage:
+@code
+WorkerPool pool;
+SessionManager sessions(pool);
+auto game = attach_session(sessions, make_estr("Game.exe"), 4);
+auto launcher = attach_session(sessions, make_estr("Launcher.exe"), 1);
+@endcode
+*/
+inline Session *attach_session(SessionManager &sessions, const estr_t &process_name, uint32_t priority = 1)
+{
+    auto &process_utils = SingletonInjector<KernelProcessUtils>::get();
+    auto pid = process_utils.pid_from_process_name(process_name);
+    if (!pid)
+        return nullptr;
+    auto process = std::make_shared<KernelProcess>(*pid);
+    if (!process->init())
+        return nullptr;
+    auto session = Session::from_process(process_name.to_string(), process, sessions.pool(), priority);
+    auto reader = instrument_reader(process.get(), "KernelProcess");
+    if (reader != process.get())
+        session->adopt_reader(std::unique_ptr<IProcessReader>(reader));
+    return &sessions.add(std::move(session));
+}
+
 }
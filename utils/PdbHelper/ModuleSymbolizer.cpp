@@ -0,0 +1,147 @@
+#include "ModuleSymbolizer.h"
+
+#include <stdio.h>
+#include <algorithm>
+
+namespace pkn
+{
+
+void ModuleSymbolizer::add(std::string name, rptr_t base, uint64_t size, std::shared_ptr<const PdbSymbolIndex> symbols)
+{
+    auto it = std::lower_bound(_bases.begin(), _bases.end(), base);
+    size_t index = it - _bases.begin();
+    Module module{ std::move(name), base, size, std::move(symbols) };
+    if (it != _bases.end() && *it == base)
+    {
+        _ends[index] = base + size;
+        _modules[index] = std::move(module);
+        return;
+    }
+    _bases.insert(it, base);
+    _ends.insert(_ends.begin() + index, base + size);
+    _modules.insert(_modules.begin() + index, std::move(module));
+}
+
+void ModuleSymbolizer::add(const ModuleRecord &module, std::shared_ptr<const PdbSymbolIndex> symbols)
+{
+    add(module.name.to_string(), module.base, module.size, std::move(symbols));
+}
+
+void ModuleSymbolizer::clear()
+{
+    _modules.clear();
+    _bases.clear();
+    _ends.clear();
+}
+
+size_t ModuleSymbolizer::module_of(rptr_t address) const noexcept
+{
+    return branchless_upper_search(_bases.data(), _ends.data(), _bases.size(), address);
+}
+
+SymbolizedAddress ModuleSymbolizer::find(rptr_t address) const noexcept
+{
+    SymbolizedAddress result;
+    result.module = module_of(address);
+    if (result.module == NotFound)
+        return result;
+    auto &module = _modules[result.module];
+    uint64_t rva = address - module.base;
+    result.offset = rva;
+    if (module.symbols != nullptr && rva <= UINT32_MAX)
+    {
+        result.symbol = module.symbols->index_of((uint32_t)rva);
+        if (result.symbol != NotFound)
+            result.offset = rva - module.symbols->rva(result.symbol);
+    }
+    return result;
+}
+
+void ModuleSymbolizer::find(const rptr_t *addresses, size_t count, SymbolizedAddress *results) const
+{
+    // unlike branchless_upper_search each lane searches the index of its own module, with its own length;
+    // a lane whose range is down to one entry stops moving
+    constexpr size_t Lanes = 8;
+    static const uint32_t NoSymbols[1] = { 0 };
+    size_t i = 0;
+    for (; i + Lanes <= count; i += Lanes)
+    {
+        const PdbSymbolIndex *symbols[Lanes];
+        const uint32_t *begins[Lanes];
+        const uint32_t *base[Lanes];
+        uint32_t rvas[Lanes];
+        size_t n[Lanes];
+        size_t longest = 1;
+        for (size_t lane = 0; lane < Lanes; lane++)
+        {
+            auto &result = results[i + lane];
+            result = SymbolizedAddress();
+            result.module = module_of(addresses[i + lane]);
+            symbols[lane] = nullptr;
+            begins[lane] = NoSymbols;
+            rvas[lane] = 0;
+            n[lane] = 1;
+            if (result.module == NotFound)
+                continue;
+            auto &module = _modules[result.module];
+            uint64_t rva = addresses[i + lane] - module.base;
+            result.offset = rva;
+            if (module.symbols == nullptr || module.symbols->empty() || rva > UINT32_MAX)
+                continue;
+            symbols[lane] = module.symbols.get();
+            begins[lane] = symbols[lane]->begins();
+            rvas[lane] = (uint32_t)rva;
+            n[lane] = symbols[lane]->size();
+            longest = std::max(longest, n[lane]);
+        }
+        for (size_t lane = 0; lane < Lanes; lane++)
+            base[lane] = begins[lane];
+        for (size_t m = longest; m > 1; m -= m / 2)
+        {
+            for (size_t lane = 0; lane < Lanes; lane++)
+            {
+                size_t half = n[lane] / 2;
+                base[lane] = base[lane][half] <= rvas[lane] ? base[lane] + half : base[lane];
+                n[lane] -= half;
+            }
+        }
+        for (size_t lane = 0; lane < Lanes; lane++)
+        {
+            if (symbols[lane] == nullptr)
+                continue;
+            size_t index = base[lane] - begins[lane];
+            if (*base[lane] <= rvas[lane] && rvas[lane] < symbols[lane]->end(index))
+            {
+                results[i + lane].symbol = index;
+                results[i + lane].offset -= *base[lane];
+            }
+        }
+    }
+    for (; i < count; i++)
+        results[i] = find(addresses[i]);
+}
+
+std::string ModuleSymbolizer::format(const SymbolizedAddress &symbolized, rptr_t address) const
+{
+    char number[32];
+    if (symbolized.module == NotFound)
+    {
+        snprintf(number, sizeof(number), "0x%llx", (unsigned long long)address);
+        return number;
+    }
+    auto &module = _modules[symbolized.module];
+    std::string result = module.name;
+    if (symbolized.symbol != NotFound)
+    {
+        result += '!';
+        result += module.symbols->name(symbolized.symbol);
+    }
+    if (symbolized.offset != 0 || symbolized.symbol == NotFound)
+    {
+        snprintf(number, sizeof(number), "+0x%llx", (unsigned long long)symbolized.offset);
+        result += number;
+    }
+    return result;
+}
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../core/base/types.h"
+#include "../../core/remote_process/ModuleIndex.h"
+#include "PdbSymbolIndex.h"
+
+namespace pkn
+{
+
+struct SymbolizedAddress
+{
+    size_t module = (size_t)-1;   // index in ModuleSymbolizer::modules(), NotFound outside every module
+    size_t symbol = (size_t)-1;   // index in the module's PdbSymbolIndex, NotFound if no symbol contains the address
+    uint64_t offset = 0;          // from the symbol, or from the module base when there is no symbol
+};
+
+/*
+Remote address to "module!symbol+offset", over the modules of a process and the symbol index of each.
+Modules are kept sorted by base, an address finds its module by a branch free binary search and
+then its symbol in that module's PdbSymbolIndex. Batch lookups interleave the searches of several
+addresses, each in the index of its own module; no COM call nor process read is involved.
+
+usage:
+@code
+ModuleSymbolizer symbolizer;
+if (auto ntoskrnl = process.module_index().find(compile_time::hashi(L"ntoskrnl.exe")))
+    symbolizer.add(*ntoskrnl, ntoskrnl_pdb.symbol_index());
+std::vector<SymbolizedAddress> hits(samples.size());
+symbolizer.find(samples.data(), samples.size(), hits.data());
+printf("%s\n", symbolizer.format(samples[0]).c_str()); // "ntoskrnl.exe!KiSystemCall64+0x1c"
+@endcode
+*/
+class ModuleSymbolizer
+{
+public:
+    constexpr static size_t NotFound = RangeNotFound;
+
+    struct Module
+    {
+        std::string name;
+        rptr_t base;
+        uint64_t size;
+        std::shared_ptr<const PdbSymbolIndex> symbols; // nullptr for modules without symbols
+    };
+public:
+    // replaces the module at the same base
+    void add(std::string name, rptr_t base, uint64_t size, std::shared_ptr<const PdbSymbolIndex> symbols);
+    void add(const ModuleRecord &module, std::shared_ptr<const PdbSymbolIndex> symbols);
+    void clear();
+    inline const std::vector<Module> &modules() const noexcept { return _modules; }
+public:
+    size_t module_of(rptr_t address) const noexcept;
+    SymbolizedAddress find(rptr_t address) const noexcept;
+    // results[i] = find(addresses[i])
+    void find(const rptr_t *addresses, size_t count, SymbolizedAddress *results) const;
+
+    // "module!symbol+0x1c", "module+0x1234" without symbol, "0x7ff612340000" outside every module
+    std::string format(const SymbolizedAddress &symbolized, rptr_t address) const;
+    inline std::string format(rptr_t address) const { return format(find(address), address); }
+private:
+    std::vector<Module> _modules;  // sorted by base
+    std::vector<rptr_t> _bases;
+    std::vector<rptr_t> _ends;     // base + size
+};
+
+}
@@ -0,0 +1,453 @@
+#include "PdbFile.h"
+
+#include <string.h>
+#include <algorithm>
+
+namespace pkn
+{
+
+namespace
+{
+
+constexpr char MsfMagic[32] = "Microsoft C/C++ MSF 7.00\r\n\x1a" "DS\0\0";
+
+struct SuperBlock
+{
+    char magic[32];
+    uint32_t block_size;
+    uint32_t free_block_map;
+    uint32_t block_count;
+    uint32_t directory_size;
+    uint32_t reserved;
+    uint32_t directory_map;     // block holding the block numbers of the directory
+};
+
+struct InfoHeader
+{
+    uint32_t version;
+    uint32_t signature;
+    uint32_t age;
+    uint8_t guid[16];
+};
+
+struct DbiHeader
+{
+    int32_t version_signature;  // -1
+    uint32_t version;
+    uint32_t age;
+    uint16_t globals_stream;
+    uint16_t build;
+    uint16_t publics_stream;
+    uint16_t dll_version;
+    uint16_t records_stream;
+    uint16_t dll_build;
+    int32_t modules_size;
+    int32_t contributions_size;
+    int32_t section_map_size;
+    int32_t files_size;
+    int32_t type_servers_size;
+    uint32_t mfc_type_server;
+    int32_t debug_header_size;
+    int32_t ec_size;
+    uint16_t flags;
+    uint16_t machine;
+    uint32_t padding;
+};
+
+// optional debug header: stream numbers, the section headers are the 6th
+constexpr uint32_t DebugSectionHeaders = 5;
+constexpr uint32_t SectionHeaderSize = 40;
+constexpr uint32_t SectionVirtualAddress = 12;
+
+// header of the publics stream, followed by the GSI hash table
+struct PublicsHeader
+{
+    uint32_t hash_size;
+    uint32_t address_map_size;
+    uint32_t thunk_count;
+    uint32_t thunk_size;
+    uint16_t thunk_section;
+    uint16_t padding;
+    uint32_t thunk_offset;
+    uint32_t section_count;
+};
+
+struct GsiHashHeader
+{
+    uint32_t signature;         // 0xFFFFFFFF
+    uint32_t version;           // GsiHashVersion
+    uint32_t records_size;
+    uint32_t buckets_size;
+};
+
+constexpr uint32_t GsiHashVersion = 0xEFFE0000 + 19990810;
+
+struct GsiHashRecord
+{
+    uint32_t offset;            // in the symbol record stream, plus 1
+    uint32_t references;
+};
+
+// the hash records are followed by a bitmap of the non empty buckets and the start of each of them
+constexpr uint32_t GsiBuckets = 4096;
+constexpr uint32_t GsiBitmapWords = (GsiBuckets + 1 + 31) / 32;
+constexpr uint32_t GsiBucketStartUnit = 12;   // bucket starts count the 12 bytes records of the writer
+
+// hashStringV1 of the pdb sources, case insensitive for ascii
+uint32_t gsi_hash(std::string_view name) noexcept
+{
+    uint32_t result = 0;
+    size_t i = 0;
+    for (; i + 4 <= name.size(); i += 4)
+    {
+        uint32_t value;
+        memcpy(&value, name.data() + i, sizeof(value));
+        result ^= value;
+    }
+    if (name.size() - i >= 2)
+    {
+        uint16_t value;
+        memcpy(&value, name.data() + i, sizeof(value));
+        result ^= value;
+        i += 2;
+    }
+    if (i < name.size())
+        result ^= (uint8_t)name[i];
+    result |= 0x20202020;
+    result ^= result >> 11;
+    return result ^ (result >> 16);
+}
+
+inline uint32_t popcount(uint32_t value) noexcept
+{
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+    return (((value + (value >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+}
+
+// symbol record kinds
+constexpr uint16_t S_LDATA32 = 0x110C;
+constexpr uint16_t S_GDATA32 = 0x110D;
+constexpr uint16_t S_PUB32 = 0x110E;
+
+// PUBSYM32 and DATASYM32 share the layout: flags or type, offset, section, name
+#pragma pack(push, 1)
+struct AddressSymbol
+{
+    uint16_t length;            // not counting itself
+    uint16_t kind;
+    uint32_t flags;
+    uint32_t offset;
+    uint16_t section;
+};
+#pragma pack(pop)
+
+constexpr uint32_t PublicCode = 1;
+constexpr uint32_t PublicFunction = 2;
+
+inline bool is_power_of_two(uint32_t value) noexcept
+{
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+}
+
+bool PdbSignature::operator==(const PdbSignature &rhs) const noexcept
+{
+    return age == rhs.age && memcmp(guid, rhs.guid, sizeof(guid)) == 0;
+}
+
+std::unique_ptr<PdbFile> PdbFile::open(const std::string &path)
+{
+    auto file = MappedFile::open(path);
+    if (file == nullptr)
+        return nullptr;
+    std::unique_ptr<PdbFile> pdb(new PdbFile());
+    pdb->_data = file->data();
+    pdb->_size = file->size();
+    pdb->_file = std::move(file);
+    if (!pdb->load())
+        return nullptr;
+    return pdb;
+}
+
+std::unique_ptr<PdbFile> PdbFile::parse(const void *data, size_t size)
+{
+    std::unique_ptr<PdbFile> pdb(new PdbFile());
+    pdb->_data = (const uint8_t *)data;
+    pdb->_size = size;
+    if (data == nullptr || !pdb->load())
+        return nullptr;
+    return pdb;
+}
+
+bool PdbFile::load_directory()
+{
+    SuperBlock super;
+    if (_size < sizeof(super))
+        return false;
+    memcpy(&super, _data, sizeof(super));
+    if (memcmp(super.magic, MsfMagic, sizeof(MsfMagic)) != 0)
+        return false;
+    if (!is_power_of_two(super.block_size) || super.block_size < 512 || super.block_size > 0x10000)
+        return false;
+    _block_size = super.block_size;
+    uint64_t block_count = _size / _block_size;
+
+    // the directory is scattered too, its block numbers are listed in directory_map
+    uint64_t directory_blocks = ((uint64_t)super.directory_size + _block_size - 1) / _block_size;
+    uint64_t map_offset = (uint64_t)super.directory_map * _block_size;
+    if (super.directory_size < sizeof(uint32_t) || map_offset > _size || directory_blocks > (_size - map_offset) / sizeof(uint32_t))
+        return false;
+    std::vector<uint8_t> directory(directory_blocks * _block_size);
+    for (uint64_t i = 0; i < directory_blocks; i++)
+    {
+        uint32_t block;
+        memcpy(&block, _data + map_offset + i * sizeof(block), sizeof(block));
+        if (block >= block_count)
+            return false;
+        memcpy(directory.data() + i * _block_size, _data + (uint64_t)block * _block_size, _block_size);
+    }
+    directory.resize(super.directory_size);
+
+    uint32_t count;
+    memcpy(&count, directory.data(), sizeof(count));
+    if (count > (directory.size() - sizeof(count)) / sizeof(uint32_t))
+        return false;
+    const uint8_t *sizes = directory.data() + sizeof(count);
+    const uint8_t *blocks = sizes + (size_t)count * sizeof(uint32_t);
+    const uint8_t *end = directory.data() + directory.size();
+    _streams.resize(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t size;
+        memcpy(&size, sizes + (size_t)i * sizeof(size), sizeof(size));
+        if (size == NilStream)
+            size = 0;
+        size_t stream_blocks = ((size_t)size + _block_size - 1) / _block_size;
+        if (stream_blocks > (size_t)(end - blocks) / sizeof(uint32_t))
+            return false;
+        _streams[i] = Stream{ size, (uint32_t)_blocks.size() };
+        for (size_t k = 0; k < stream_blocks; k++)
+        {
+            uint32_t block;
+            memcpy(&block, blocks, sizeof(block));
+            blocks += sizeof(block);
+            if (block >= block_count)
+                return false;
+            _blocks.push_back(block);
+        }
+    }
+    return true;
+}
+
+bool PdbFile::load()
+{
+    if (!load_directory())
+        return false;
+
+    auto info = read<InfoHeader>(InfoStream, 0);
+    auto dbi = read<DbiHeader>(DbiStream, 0);
+    if (!info || !dbi || dbi->version_signature != -1)
+        return false;
+    memcpy(_signature.guid, info->guid, sizeof(_signature.guid));
+    _signature.age = dbi->age;
+    _machine = dbi->machine;
+    auto stream_number = [](uint16_t stream)
+    {
+        return stream == 0xFFFF ? NilStream : stream;
+    };
+    _globals_stream = stream_number(dbi->globals_stream);
+    _publics_stream = stream_number(dbi->publics_stream);
+    _records_stream = stream_number(dbi->records_stream);
+
+    // substreams precede the optional debug header in this order
+    int32_t sizes[] = { dbi->modules_size, dbi->contributions_size, dbi->section_map_size, dbi->files_size, dbi->type_servers_size, dbi->ec_size };
+    uint64_t debug_header = sizeof(DbiHeader);
+    for (auto size : sizes)
+    {
+        if (size < 0)
+            return false;
+        debug_header += (uint32_t)size;
+    }
+    if (dbi->debug_header_size >= (int32_t)((DebugSectionHeaders + 1) * sizeof(uint16_t)) && debug_header <= UINT32_MAX)
+    {
+        auto sections = read<uint16_t>(DbiStream, (uint32_t)debug_header + DebugSectionHeaders * sizeof(uint16_t));
+        if (sections && *sections != 0xFFFF)
+        {
+            auto stream = read_stream(*sections);
+            _section_rvas.resize(stream.size() / SectionHeaderSize);
+            for (size_t i = 0; i < _section_rvas.size(); i++)
+                memcpy(&_section_rvas[i], stream.data() + i * SectionHeaderSize + SectionVirtualAddress, sizeof(uint32_t));
+        }
+    }
+    return true;
+}
+
+uint32_t PdbFile::stream_size(uint32_t stream) const noexcept
+{
+    return stream < _streams.size() ? _streams[stream].size : 0;
+}
+
+bool PdbFile::read(uint32_t stream, uint32_t offset, uint32_t size, void *buffer) const noexcept
+{
+    if (stream >= _streams.size())
+        return false;
+    auto &s = _streams[stream];
+    if (offset > s.size || size > s.size - offset)
+        return false;
+    auto out = (uint8_t *)buffer;
+    while (size != 0)
+    {
+        uint32_t block = _blocks[s.first_block + offset / _block_size];
+        uint32_t in_block = offset % _block_size;
+        uint32_t chunk = std::min(size, _block_size - in_block);
+        memcpy(out, _data + (uint64_t)block * _block_size + in_block, chunk);
+        out += chunk;
+        offset += chunk;
+        size -= chunk;
+    }
+    return true;
+}
+
+std::vector<uint8_t> PdbFile::read_stream(uint32_t stream) const
+{
+    std::vector<uint8_t> data(stream_size(stream));
+    if (!read(stream, 0, (uint32_t)data.size(), data.data()))
+        return {};
+    return data;
+}
+
+std::optional<uint32_t> PdbFile::rva(uint16_t section, uint32_t offset) const noexcept
+{
+    if (section == 0 || section > _section_rvas.size())
+        return std::nullopt;
+    return _section_rvas[section - 1] + offset;
+}
+
+const std::vector<uint8_t> &PdbFile::records() const
+{
+    std::call_once(_records_once, [this]()
+                   {
+                       _records = read_stream(_records_stream);
+                   });
+    return _records;
+}
+
+void PdbFile::collect(uint32_t stream, uint32_t offset, std::vector<PdbSymbol> &out) const
+{
+    auto header = read<GsiHashHeader>(stream, offset);
+    if (!header || header->signature != 0xFFFFFFFF || header->version != GsiHashVersion)
+        return;
+    std::vector<GsiHashRecord> hash_records(header->records_size / sizeof(GsiHashRecord));
+    if (!read(stream, offset + sizeof(GsiHashHeader), (uint32_t)(hash_records.size() * sizeof(GsiHashRecord)), hash_records.data()))
+        return;
+
+    auto &data = records();
+    out.reserve(out.size() + hash_records.size());
+    for (auto &record : hash_records)
+    {
+        size_t at = (size_t)record.offset - 1;
+        AddressSymbol symbol;
+        if (record.offset == 0 || at > data.size() || data.size() - at < sizeof(symbol))
+            continue;
+        memcpy(&symbol, data.data() + at, sizeof(symbol));
+        if (symbol.kind != S_PUB32 && symbol.kind != S_GDATA32 && symbol.kind != S_LDATA32)
+            continue;
+        size_t end = std::min(at + sizeof(uint16_t) + symbol.length, data.size());
+        if (end < at + sizeof(symbol))
+            continue;
+        auto address = rva(symbol.section, symbol.offset);
+        if (!address)
+            continue;
+        auto name = (const char *)data.data() + at + sizeof(symbol);
+        out.push_back(PdbSymbol{ std::string_view(name, strnlen(name, end - at - sizeof(symbol))), *address,
+                                 symbol.kind == S_PUB32 && (symbol.flags & (PublicCode | PublicFunction)) != 0 });
+    }
+}
+
+std::vector<PdbSymbol> PdbFile::symbols() const
+{
+    std::vector<PdbSymbol> result;
+    if (_publics_stream != NilStream)
+        collect(_publics_stream, sizeof(PublicsHeader), result);
+    if (_globals_stream != NilStream)
+        collect(_globals_stream, 0, result);
+    return result;
+}
+
+std::optional<uint32_t> PdbFile::find(uint32_t stream, uint32_t offset, std::string_view name) const
+{
+    auto header = read<GsiHashHeader>(stream, offset);
+    if (!header || header->signature != 0xFFFFFFFF || header->version != GsiHashVersion)
+        return std::nullopt;
+    uint32_t records_offset = offset + sizeof(GsiHashHeader);
+    uint32_t record_count = header->records_size / sizeof(GsiHashRecord);
+    uint32_t buckets_offset = records_offset + header->records_size;
+    uint32_t bitmap[GsiBitmapWords];
+    if (header->buckets_size < sizeof(bitmap) || !read(stream, buckets_offset, sizeof(bitmap), bitmap))
+        return std::nullopt;
+
+    // the bucket is the rank of its bit among the non empty ones
+    uint32_t bucket = gsi_hash(name) % GsiBuckets;
+    if ((bitmap[bucket / 32] & (1u << (bucket % 32))) == 0)
+        return std::nullopt;
+    uint32_t rank = popcount(bitmap[bucket / 32] & ((1u << (bucket % 32)) - 1));
+    for (uint32_t i = 0; i < bucket / 32; i++)
+        rank += popcount(bitmap[i]);
+    uint32_t nonempty = 0;
+    for (auto word : bitmap)
+        nonempty += popcount(word);
+
+    uint32_t starts_offset = buckets_offset + sizeof(bitmap);
+    auto first = read<uint32_t>(stream, starts_offset + rank * sizeof(uint32_t));
+    if (!first)
+        return std::nullopt;
+    uint32_t begin = *first / GsiBucketStartUnit;
+    uint32_t end = record_count;
+    if (rank + 1 < nonempty)
+    {
+        auto next = read<uint32_t>(stream, starts_offset + (rank + 1) * sizeof(uint32_t));
+        if (!next)
+            return std::nullopt;
+        end = *next / GsiBucketStartUnit;
+    }
+    end = std::min(end, record_count);
+
+    std::string buffer;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        auto record = read<GsiHashRecord>(stream, records_offset + i * sizeof(GsiHashRecord));
+        if (!record || record->offset == 0)
+            continue;
+        uint32_t at = record->offset - 1;
+        auto symbol = read<AddressSymbol>(_records_stream, at);
+        if (!symbol || (symbol->kind != S_PUB32 && symbol->kind != S_GDATA32 && symbol->kind != S_LDATA32))
+            continue;
+        // the name and its terminator, bounded by the record
+        uint32_t available = sizeof(uint16_t) + symbol->length > sizeof(AddressSymbol) ? sizeof(uint16_t) + symbol->length - sizeof(AddressSymbol) : 0;
+        uint32_t compared = (uint32_t)std::min<size_t>(name.size() + 1, available);
+        if (compared < name.size())
+            continue;
+        buffer.resize(compared);
+        if (!read(_records_stream, at + sizeof(AddressSymbol), compared, buffer.data()))
+            continue;
+        if (memcmp(buffer.data(), name.data(), name.size()) != 0 || (compared > name.size() && buffer[name.size()] != '\0'))
+            continue;
+        if (auto address = rva(symbol->section, symbol->offset))
+            return address;
+    }
+    return std::nullopt;
+}
+
+std::optional<uint32_t> PdbFile::find(std::string_view name) const
+{
+    if (_publics_stream != NilStream)
+        if (auto address = find(_publics_stream, sizeof(PublicsHeader), name))
+            return address;
+    if (_globals_stream != NilStream)
+        return find(_globals_stream, 0, name);
+    return std::nullopt;
+}
+
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../core/base/noncopyable.h"
+#include "../../core/base/fs/MappedFile.h"
+
+namespace pkn
+{
+
+struct PdbSignature
+{
+    uint8_t guid[16];   // as stored, the same bytes as the CodeView entry of the image
+    uint32_t age;       // age of the DBI stream, the one the image refers to
+public:
+    bool operator==(const PdbSignature &rhs) const noexcept;
+    inline bool operator!=(const PdbSignature &rhs) const noexcept { return !(*this == rhs); }
+};
+
+struct PdbSymbol
+{
+    std::string_view name;  // as stored, decorated; views the PdbFile
+    uint32_t rva;
+    bool code;              // public marked as code or function
+};
+
+/*
+Native reader of MSF 7.00 program databases, no DIA, COM or Windows needed.
+The file is mapped, streams are read through the block map, and symbols come from the DBI
+stream: the publics(PSGSI) and globals(GSI) hash records point into the symbol record stream,
+section:offset addresses are turned into rva by the section headers stream.
+find() looks one name up through the hash buckets of those tables instead, reading only the
+bucket and the records it lists, so a few lookups cost a few pages whatever the pdb size.
+Symbols of OMAP reordered images are not translated.
+
+usage:
+@code
+auto pdb = PdbFile::open("ntkrnlmp.pdb");
+for (auto &symbol : pdb->symbols())
+    printf("%08x %.*s\n", symbol.rva, (int)symbol.name.size(), symbol.name.data());
+auto rva = pdb->find("PsLoadedModuleList");
+@endcode
+*/
+class PdbFile : noncopyable
+{
+public:
+    constexpr static uint32_t NilStream = 0xFFFFFFFF;
+    constexpr static uint32_t InfoStream = 1;
+    constexpr static uint32_t DbiStream = 3;
+public:
+    // nullptr if the file can not be mapped or is not a MSF 7.00 pdb with a DBI stream
+    static std::unique_ptr<PdbFile> open(const std::string &path);
+    // data must outlive the PdbFile
+    static std::unique_ptr<PdbFile> parse(const void *data, size_t size);
+public:
+    inline const PdbSignature &signature() const noexcept { return _signature; }
+    inline uint16_t machine() const noexcept { return _machine; }
+    inline uint32_t block_size() const noexcept { return _block_size; }
+
+    inline size_t stream_count() const noexcept { return _streams.size(); }
+    // 0 for missing and nil streams
+    uint32_t stream_size(uint32_t stream) const noexcept;
+    // false if [offset, offset + size) is not in the stream
+    bool read(uint32_t stream, uint32_t offset, uint32_t size, void *buffer) const noexcept;
+    template <class T>
+    inline std::optional<T> read(uint32_t stream, uint32_t offset) const noexcept
+    {
+        T value;
+        if (!read(stream, offset, sizeof(T), &value))
+            return std::nullopt;
+        return value;
+    }
+    // the whole stream, empty if missing
+    std::vector<uint8_t> read_stream(uint32_t stream) const;
+
+    // rva of section:offset, section is 1 based
+    std::optional<uint32_t> rva(uint16_t section, uint32_t offset) const noexcept;
+
+    // every public and global data symbol that has an rva; a name may appear as both
+    std::vector<PdbSymbol> symbols() const;
+    // rva of the public or global data symbol named name, publics first; name is matched as stored
+    std::optional<uint32_t> find(std::string_view name) const;
+private:
+    PdbFile() = default;
+    bool load();
+    bool load_directory();
+    // symbol record stream, contiguous; loaded on first use
+    const std::vector<uint8_t> &records() const;
+    // appends the symbols a GSI hash table at offset of stream refers to
+    void collect(uint32_t stream, uint32_t offset, std::vector<PdbSymbol> &out) const;
+    // looks name up in the bucket of a GSI hash table at offset of stream
+    std::optional<uint32_t> find(uint32_t stream, uint32_t offset, std::string_view name) const;
+private:
+    struct Stream
+    {
+        uint32_t size;
+        uint32_t first_block;   // index in _blocks
+    };
+private:
+    std::unique_ptr<MappedFile> _file;
+    const uint8_t *_data = nullptr;
+    size_t _size = 0;
+    uint32_t _block_size = 0;
+
+    std::vector<Stream> _streams;
+    std::vector<uint32_t> _blocks;
+
+    PdbSignature _signature{};
+    uint16_t _machine = 0;
+    uint32_t _globals_stream = NilStream;
+    uint32_t _publics_stream = NilStream;
+    uint32_t _records_stream = NilStream;
+    std::vector<uint32_t> _section_rvas;
+
+    mutable std::once_flag _records_once;
+    mutable std::vector<uint8_t> _records;
+};
+
+}
@@ -1,143 +1,246 @@
-#include <Windows.h>
-
 #include "PdbHelper.h"
 
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include "../../core/pe_structure/PEView.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <urlmon.h>
+#pragma comment(lib, "urlmon.lib")
+#endif
+
 namespace pkn
 {
 
-PdbHelper::PdbHelper()
-{}
+namespace
+{
 
-PdbHelper::~PdbHelper()
+// "GUIDage" directory of the symbol server layout, guid fields as the debugger prints them
+std::string symbol_directory(const PdbSignature &signature)
 {
-    // Must be released before CoUninitialize
-    if (_global)
-        _global->Release();
-    if (_session)
-        _session->Release();
-    if (_source)
-        _source->Release();
-    CoUninitialize();
+    uint32_t data1;
+    uint16_t data2, data3;
+    memcpy(&data1, signature.guid, sizeof(data1));
+    memcpy(&data2, signature.guid + 4, sizeof(data2));
+    memcpy(&data3, signature.guid + 6, sizeof(data3));
+    char buffer[64];
+    int length = snprintf(buffer, sizeof(buffer), "%08X%04X%04X", data1, data2, data3);
+    for (int i = 8; i < 16; i++)
+        length += snprintf(buffer + length, sizeof(buffer) - length, "%02X", signature.guid[i]);
+    snprintf(buffer + length, sizeof(buffer) - length, "%X", signature.age);
+    return buffer;
 }
 
-bool PdbHelper::init(const estr_t &filepath, const estr_t &local_cache_path)
+}
+
+bool PdbHelper::init(const estr_t &filepath, const estr_t &local_cache_path, bool lazy)
 {
-    HRESULT hr = CoInitialize(nullptr);
-    if (S_OK != hr && S_FALSE != hr && RPC_E_CHANGED_MODE != hr)
+    std::error_code ec;
+    auto full_path = std::filesystem::absolute(local_cache_path.to_wstring(), ec);
+    if (ec)
         return false;
-
-    auto full_path = std::filesystem::absolute(local_cache_path.to_wstring().c_str());
-    if (!std::filesystem::exists(full_path))
-        if (!std::filesystem::create_directory(full_path))
+    if (!std::filesystem::exists(full_path, ec))
+        if (!std::filesystem::create_directory(full_path, ec))
             return false;
 
-    auto symbol_path = this->make_symbol_path(full_path.wstring());
-
-    // dia source
-    _source = this->create_ida_source();
-    if (nullptr == _source)
+    // pdb signature from the image
+    std::filesystem::path image_path(filepath.to_wstring());
+    _image = MappedFile::open(image_path.string());
+    if (_image == nullptr)
         return false;
-
-    // load pdb
-    hr = _source->loadDataForExe(filepath.to_wstring().c_str(), symbol_path.to_wstring().c_str(), nullptr);
-    if (S_OK != hr)
+    auto pe = PEView::parse(_image->data(), _image->size());
+    if (!pe)
         return false;
-    hr = _source->openSession(&_session);
-    if (S_OK != hr)
+    auto codeview = pe->codeview();
+    if (!codeview)
         return false;
-    hr = _session->get_globalScope(&_global);
-    if (S_OK != hr)
+    PdbSignature signature;
+    memcpy(signature.guid, codeview->guid, sizeof(signature.guid));
+    signature.age = codeview->age;
+
+    // the symbol server layout, name\GUIDage\name
+    auto slash = codeview->pdb_path.find_last_of("\\/");
+    auto pdb_name = std::string(slash == std::string_view::npos ? codeview->pdb_path : codeview->pdb_path.substr(slash + 1));
+    if (pdb_name.empty())
         return false;
+    auto cache_directory = full_path / pdb_name / symbol_directory(signature);
+    auto cache_file = cache_directory / (pdb_name + ".symbols");
+
+    _symbols = PdbSymbolCache::open(cache_file.string(), signature);
+    if (_symbols != nullptr)
+        return true;
 
-    if (!this->populate_symbols())
+    auto pdb = open_pdb(image_path, cache_directory, std::string(codeview->pdb_path), signature);
+    if (pdb == nullptr)
+        return false;
+    if (lazy)
+    {
+        _pdb = std::move(pdb);
+        return true;
+    }
+    _symbols = make_symbols(*pdb);
+    if (_symbols == nullptr)
         return false;
 
+    // best effort, a read only cache only costs the next run a pdb read
+    std::filesystem::create_directories(cache_directory, ec);
+    _symbols->save(cache_file.string());
     return true;
 }
 
-IDiaDataSource *PdbHelper::create_ida_source()
+std::unique_ptr<PdbFile> PdbHelper::open_pdb(const std::filesystem::path &image_path,
+                                             const std::filesystem::path &cache_directory,
+                                             const std::string &pdb_path,
+                                             const PdbSignature &signature)
 {
-    IDiaDataSource *source = nullptr;
-    // Try to get from COM
-    HRESULT hr = CoCreateInstance(CLSID_DiaSource,
-                                  nullptr,
-                                  CLSCTX_INPROC_SERVER,
-                                  __uuidof(IDiaDataSource),
-                                  reinterpret_cast<void **>(&_source)
-    );
-
-    if (hr == REGDB_E_CLASSNOTREG)
+    auto slash = pdb_path.find_last_of("\\/");
+    auto pdb_name = slash == std::string::npos ? pdb_path : pdb_path.substr(slash + 1);
+
+    std::filesystem::path candidates[] = {
+        cache_directory / pdb_name,
+        image_path.parent_path() / pdb_name,
+        std::filesystem::path(pdb_path),
+    };
+    for (auto &candidate : candidates)
     {
-        // Retry with direct export call
-
-        // load library
-        HMODULE msdia140 = LoadLibraryW(L"msdia140.dll");
-        if (!msdia140)
-            return false;
-
-        // get DllGetClassObject
-        using fGetClassObject = HRESULT(WINAPI*)(REFCLSID, REFIID, void **);
-
-        auto proc_name = make_DllGetClassObject();
-        auto DllGetClassObject = reinterpret_cast<fGetClassObject>(
-            GetProcAddress(msdia140, proc_name.to_string().c_str()));
-
-        if (!DllGetClassObject)
-            return false;
-
-        // get IClassFactory
-        IClassFactory *classFactory;
-        hr = DllGetClassObject(CLSID_DiaSource, IID_IClassFactory, reinterpret_cast<void **>(&classFactory));
-        if (S_OK != hr)
-            return false;
-
-        // create instance
-        HRESULT hr = classFactory->CreateInstance(nullptr, IID_IDiaDataSource, reinterpret_cast<void **>(&source));
-
-        return source;
+        auto pdb = PdbFile::open(candidate.string());
+        if (pdb != nullptr && pdb->signature() == signature)
+            return pdb;
     }
-    return source;
+
+    if (!download(pdb_name + "/" + symbol_directory(signature) + "/" + pdb_name, candidates[0]))
+        return nullptr;
+    auto pdb = PdbFile::open(candidates[0].string());
+    if (pdb == nullptr || pdb->signature() != signature)
+        return nullptr;
+    return pdb;
 }
 
-bool PdbHelper::populate_symbols()
+bool PdbHelper::download(const std::string &relative_path, const std::filesystem::path &target)
 {
-    IDiaEnumSymbols *enumurator;
-    auto hr = _global->findChildren(SymTagNull, nullptr, nsNone, &enumurator);
-    if (S_OK != hr)
+#ifdef _WIN32
+    std::error_code ec;
+    std::filesystem::create_directories(target.parent_path(), ec);
+    if (ec)
+        return false;
+    auto url = make_symbol_server().to_wstring() + std::wstring(relative_path.begin(), relative_path.end());
+    // downloaded aside, a partial file never takes the place of the pdb
+    auto temp = target;
+    temp += L".download";
+    if (S_OK != URLDownloadToFileW(nullptr, url.c_str(), temp.wstring().c_str(), 0, nullptr))
         return false;
+    std::filesystem::rename(temp, target, ec);
+    return !ec;
+#else
+    return false;
+#endif
+}
 
-    ULONG count = 0;
-    IDiaSymbol *isymbol;
-    while (S_OK == (enumurator->Next(1, &isymbol, &count)) && count != 0)
+std::unique_ptr<PdbSymbolCache> PdbHelper::make_symbols(const PdbFile &pdb)
+{
+    auto symbols = pdb.symbols();
+    for (auto &symbol : symbols)
     {
-        DWORD rva = 0;
-        wchar_t *name = nullptr;
+        auto &name = symbol.name;
 
-        isymbol->get_relativeVirtualAddress(&rva);
-        isymbol->get_undecoratedName(&name);
-
-        if (name && rva)
+        // Remove x86 __stdcall decoration, c++ names are kept decorated
+        if (!name.empty() && name[0] != '?')
         {
-            std::wstring wname(name);
-
-            // Remove x86 __stdcall decoration
-            if (wname[0] == L'@' || wname[0] == L'_')
+            if (name[0] == '@' || name[0] == '_')
             {
-                wname.erase(0, 1);
+                name.remove_prefix(1);
             }
 
-            auto pos = wname.rfind(L'@');
-            if (pos != wname.npos)
+            auto pos = name.rfind('@');
+            if (pos != name.npos)
             {
-                wname.erase(pos);
+                name = name.substr(0, pos);
             }
-
-            _cache.emplace(wname, rva);
         }
+    }
+    symbols.erase(std::remove_if(symbols.begin(), symbols.end(), [](const PdbSymbol &symbol)
+                                 {
+                                     return symbol.name.empty() || symbol.rva == 0;
+                                 }),
+                  symbols.end());
+    return PdbSymbolCache::build(pdb.signature(), std::move(symbols));
+}
+std::optional<uint32_t> PdbHelper::lookup(const std::string &name)
+{
+    _lookups++;
+    for (auto &recent : _recent)
+    {
+        if (recent.name == name)
+        {
+            recent.used = _lookups;
+            return recent.rva;
+        }
+    }
 
-        isymbol->Release();
+    // the names make_symbols() would give: c++ names as stored, others with one leading '_' or '@' and
+    // an "@N" suffix dropped; the hash tables only find the names without suffix
+    std::optional<uint32_t> rva;
+    auto found = [&](const std::string &stored)
+    {
+        rva = _pdb->find(stored);
+        if (rva && *rva == 0)
+            rva.reset();
+        return rva.has_value();
+    };
+    if (!name.empty() && name[0] == '?')
+        found(name);
+    else if (!name.empty() && name.find('@') == std::string::npos)
+    {
+        if (name[0] == '_' || name[0] == '@' || !found(name))
+            if (!found("_" + name))
+                found("@" + name);
     }
-    enumurator->Release();
-    return true;
+
+    // x86 __stdcall and __fastcall names carry the suffix, those are only found by enumerating the pdb
+    if (!rva && _pdb->machine() == pe_format::MachineI386)
+    {
+        _symbols = make_symbols(*_pdb);
+        if (_symbols != nullptr)
+            return _symbols->find(name);
+    }
+
+    if (_recent.size() < MaxRecentSymbols)
+    {
+        _recent.push_back(RecentSymbol{ name, rva, _lookups });
+    }
+    else
+    {
+        auto oldest = std::min_element(_recent.begin(), _recent.end(), [](const RecentSymbol &lhs, const RecentSymbol &rhs)
+                                       {
+                                           return lhs.used < rhs.used;
+                                       });
+        *oldest = RecentSymbol{ name, rva, _lookups };
+    }
+    return rva;
+}
+std::shared_ptr<const PdbSymbolIndex> PdbHelper::symbol_index()
+{
+    if (_index != nullptr)
+        return _index;
+    // lazy mode enumerates the pdb now, the names are undecorated the same way
+    std::unique_ptr<PdbSymbolCache> enumerated;
+    auto symbols = _symbols.get();
+    if (symbols == nullptr && _pdb != nullptr)
+    {
+        enumerated = make_symbols(*_pdb);
+        symbols = enumerated.get();
+    }
+    if (symbols == nullptr || _image == nullptr)
+        return nullptr;
+
+    std::vector<PdbSymbol> list(symbols->size());
+    for (size_t i = 0; i < list.size(); i++)
+        list[i] = symbols->symbol(i);
+    auto pe = PEView::parse(_image->data(), _image->size());
+    _index = std::make_shared<PdbSymbolIndex>(PdbSymbolIndex::build(std::move(list), pe ? &*pe : nullptr));
+    return _index;
 }
 }
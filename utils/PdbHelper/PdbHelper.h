@@ -2,60 +2,85 @@
 
 #include "../../core/base/types.h"
 #include <filesystem>
-#include <unordered_map>
+#include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
-#include "../../core/base/types.h"
-#include "dia/dia2.h"
-
-#if defined(_AMD64_)
-#pragma comment(lib, "diaguids64.lib")
-#else
-#pragma comment(lib, "diaguids.lib")
-#endif
+#include "../../core/base/fs/MappedFile.h"
+#include "PdbFile.h"
+#include "PdbSymbolCache.h"
+#include "PdbSymbolIndex.h"
 
 
 namespace pkn
 {
+/*
+Symbol name to rva map of an image, read from its pdb by PdbFile.
+The pdb matching the CodeView entry of the image is looked up in local_cache_path with the symbol
+server layout(name\GUIDage\name), next to the image and at the path the image records.
+On Windows a missing pdb is downloaded from the Microsoft symbol server into local_cache_path.
+The symbols are saved next to the pdb as a PdbSymbolCache, later runs map that file and do not
+read the pdb at all.
+With lazy set and no cache saved yet, nothing is enumerated: each name is looked up in the pdb
+hash tables when asked for, and the last few results are remembered. Names are matched the way the
+enumerated symbols are named, without the leading '_' or '@'; names whose "@N" suffix is dropped can
+not be found through the hash tables, so an x86 image falls back to enumerating the pdb on a miss.
+symbol_index() gives the reverse, rva to symbol, for ModuleSymbolizer.
+*/
 class PdbHelper
 {
 public:
-    PdbHelper();
-    ~PdbHelper();
-public:
-    bool init(const estr_t &filepath, const estr_t &local_cache_path);
+    bool init(const estr_t &filepath, const estr_t &local_cache_path, bool lazy = false);
 
     std::optional<euint32_t> symbol_address(const estr_t &symbol_name)
     {
-        if (auto it = _cache.find(symbol_name); it != _cache.end())
+        std::optional<uint32_t> rva;
+        if (_symbols != nullptr)
+            rva = _symbols->find(symbol_name.to_string());
+        else if (_pdb != nullptr)
+            rva = this->lookup(symbol_name.to_string());
+        if (rva)
         {
-            return it->second;
+            return *rva;
         }
         return std::nullopt;
     }
+
+    // rva sorted symbols of the image, built on first use; nullptr before a successful init
+    std::shared_ptr<const PdbSymbolIndex> symbol_index();
 private:
-    IDiaDataSource *create_ida_source();
-    bool populate_symbols();
+    // nullptr if no pdb matching signature is found or can be downloaded
+    static std::unique_ptr<PdbFile> open_pdb(const std::filesystem::path &image_path,
+                                             const std::filesystem::path &cache_directory,
+                                             const std::string &pdb_path,
+                                             const PdbSignature &signature);
+    static bool download(const std::string &relative_path, const std::filesystem::path &target);
+    // symbol names without x86 decorations
+    static std::unique_ptr<PdbSymbolCache> make_symbols(const PdbFile &pdb);
+    // lazy mode: the pdb hash tables behind a small LRU
+    std::optional<uint32_t> lookup(const std::string &name);
 private:
     // make the compiler happy
-    static estr_t make_symbol_path(const std::wstring &local_cache_path) noexcept
+    static estr_t make_symbol_server() noexcept
     {
-        return
-        estr_t(make_estr("srv*")) +
-        estr_t(local_cache_path) +
-        estr_t(make_estr("*https://msdl.microsoft.com/download/symbols"));
-    }
-
-    // make the compiler happy
-    static auto make_DllGetClassObject() noexcept
-    {
-        return make_const_encrypted_string("DllGetClassObject");
+        return estr_t(make_estr("https://msdl.microsoft.com/download/symbols/"));
     }
 private:
-    IDiaDataSource *_source = nullptr;
-    IDiaSession *_session = nullptr;
-    IDiaSymbol *_global = nullptr;
+    std::unique_ptr<MappedFile> _image;
+    std::unique_ptr<PdbSymbolCache> _symbols;      // Symbol name <--> RVA map
+    std::shared_ptr<const PdbSymbolIndex> _index;  // RVA <--> Symbol name
 
-    std::unordered_map<estr_t, euint32_t> _cache;      // Symbol name <--> RVA map
+    // lazy mode
+    struct RecentSymbol
+    {
+        std::string name;
+        std::optional<uint32_t> rva;                // misses are remembered too
+        uint64_t used;
+    };
+    constexpr static size_t MaxRecentSymbols = 64;
+    std::unique_ptr<PdbFile> _pdb;
+    std::vector<RecentSymbol> _recent;
+    uint64_t _lookups = 0;
 };
 }
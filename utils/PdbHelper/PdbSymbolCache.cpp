@@ -0,0 +1,144 @@
+#include "PdbSymbolCache.h"
+#include "../../core/base/fs/binary_file.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+namespace pkn
+{
+
+namespace
+{
+
+struct FileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t count;
+    uint8_t guid[16];
+    uint32_t age;
+    uint32_t string_size;
+    uint64_t entries;         // file offsets
+    uint64_t strings;
+};
+
+}
+
+std::unique_ptr<PdbSymbolCache> PdbSymbolCache::build(const PdbSignature &signature, std::vector<PdbSymbol> symbols)
+{
+    std::stable_sort(symbols.begin(), symbols.end(), [](const PdbSymbol &lhs, const PdbSymbol &rhs)
+                     {
+                         return lhs.name < rhs.name;
+                     });
+    symbols.erase(std::unique(symbols.begin(), symbols.end(), [](const PdbSymbol &lhs, const PdbSymbol &rhs)
+                              {
+                                  return lhs.name == rhs.name;
+                              }),
+                  symbols.end());
+
+    FileHeader header = {};
+    memcpy(header.magic, PdbSymbolCacheMagic, sizeof(header.magic));
+    header.version = PdbSymbolCacheVersion;
+    header.count = (uint32_t)symbols.size();
+    memcpy(header.guid, signature.guid, sizeof(header.guid));
+    header.age = signature.age;
+    uint64_t string_size = 0;
+    for (auto &symbol : symbols)
+        string_size += symbol.name.size() + 1;
+    if (string_size > UINT32_MAX)
+        return nullptr;
+    header.string_size = (uint32_t)string_size;
+    header.entries = align8(sizeof(header));
+    header.strings = align8(header.entries + symbols.size() * sizeof(PdbSymbolCacheEntry));
+
+    std::unique_ptr<PdbSymbolCache> cache(new PdbSymbolCache());
+    auto &buffer = cache->_buffer;
+    buffer.resize(header.strings + header.string_size);
+    memcpy(buffer.data(), &header, sizeof(header));
+    auto entries = (PdbSymbolCacheEntry *)(buffer.data() + header.entries);
+    auto strings = (char *)buffer.data() + header.strings;
+    uint32_t offset = 0;
+    for (size_t i = 0; i < symbols.size(); i++)
+    {
+        auto &symbol = symbols[i];
+        entries[i] = PdbSymbolCacheEntry{ offset, (uint32_t)symbol.name.size(), symbol.rva, symbol.code ? FlagCode : 0 };
+        memcpy(strings + offset, symbol.name.data(), symbol.name.size());
+        offset += (uint32_t)symbol.name.size();
+        strings[offset++] = '\0';
+    }
+    if (!cache->attach(buffer.data(), buffer.size()))
+        return nullptr;
+    return cache;
+}
+
+std::unique_ptr<PdbSymbolCache> PdbSymbolCache::open(const std::string &path, const PdbSignature &signature)
+{
+    std::unique_ptr<PdbSymbolCache> cache(new PdbSymbolCache());
+    cache->_file = MappedFile::open(path);
+    if (cache->_file == nullptr || !cache->attach(cache->_file->data(), cache->_file->size()))
+        return nullptr;
+    if (cache->_signature != signature)
+        return nullptr;
+    return cache;
+}
+
+bool PdbSymbolCache::attach(const uint8_t *data, size_t size)
+{
+    FileHeader header;
+    if (size < sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, PdbSymbolCacheMagic, sizeof(header.magic)) != 0 || header.version != PdbSymbolCacheVersion)
+        return false;
+    auto inside = [&](uint64_t offset, uint64_t count, size_t record_size)
+    {
+        return offset % 4 == 0 && offset <= size && count * record_size <= size - offset;
+    };
+    if (!inside(header.entries, header.count, sizeof(PdbSymbolCacheEntry)) || !inside(header.strings, header.string_size, 1))
+        return false;
+    auto entries = (const PdbSymbolCacheEntry *)(data + header.entries);
+    // every name is checked once here, lookups then use the table freely
+    for (uint32_t i = 0; i < header.count; i++)
+    {
+        auto &entry = entries[i];
+        if ((uint64_t)entry.name + entry.name_length >= header.string_size)
+            return false;
+    }
+    _data = data;
+    _size = size;
+    memcpy(_signature.guid, header.guid, sizeof(_signature.guid));
+    _signature.age = header.age;
+    _entries = entries;
+    _count = header.count;
+    _strings = (const char *)data + header.strings;
+    return true;
+}
+
+bool PdbSymbolCache::save(const std::string &path) const
+{
+    return write_file_replacing(path, [&](FILE *file)
+                                {
+                                    return fwrite(_data, 1, _size, file) == _size;
+                                });
+}
+
+std::optional<uint32_t> PdbSymbolCache::find(std::string_view name) const noexcept
+{
+    auto last = _entries + _count;
+    auto it = std::lower_bound(_entries, last, name, [this](const PdbSymbolCacheEntry &entry, std::string_view name)
+                               {
+                                   return this->name(entry) < name;
+                               });
+    if (it == last || this->name(*it) != name)
+        return std::nullopt;
+    return it->rva;
+}
+
+PdbSymbol PdbSymbolCache::symbol(size_t index) const noexcept
+{
+    auto &entry = _entries[index];
+    return PdbSymbol{ name(entry), entry.rva, (entry.flags & FlagCode) != 0 };
+}
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../core/base/noncopyable.h"
+#include "../../core/base/fs/MappedFile.h"
+#include "PdbFile.h"
+
+namespace pkn
+{
+
+constexpr const char PdbSymbolCacheMagic[8] = { 'P', 'K', 'N', 'S', 'Y', 'M', 'C', '\0' };
+constexpr const uint32_t PdbSymbolCacheVersion = 1;
+
+#pragma pack(push, 4)
+struct PdbSymbolCacheEntry
+{
+    uint32_t name;            // offset in the string table
+    uint32_t name_length;
+    uint32_t rva;
+    uint32_t flags;           // PdbSymbolCache::FlagCode
+};
+#pragma pack(pop)
+
+/*
+The symbols of one pdb saved to a flat file, so later runs map it instead of reading the pdb.
+The file is keyed by the pdb signature: open() refuses a file written for another GUID or age.
+Entries are sorted by name and point into one string table, a lookup is a binary search on
+the mapped file.
+
+usage:
+@code
+auto cache = PdbSymbolCache::open("ntkrnlmp.pdb.symbols", signature);
+if (cache == nullptr)
+{
+    auto pdb = PdbFile::open("ntkrnlmp.pdb");
+    cache = PdbSymbolCache::build(pdb->signature(), pdb->symbols());
+    cache->save("ntkrnlmp.pdb.symbols");
+}
+auto rva = cache->find("PsLoadedModuleList");
+@endcode
+*/
+class PdbSymbolCache : noncopyable
+{
+public:
+    constexpr static uint32_t FlagCode = 1;
+public:
+    // in memory; entries sorted by name, the first of the symbols sharing a name is kept
+    static std::unique_ptr<PdbSymbolCache> build(const PdbSignature &signature, std::vector<PdbSymbol> symbols);
+    // nullptr if the file is missing, malformed or was written for another pdb
+    static std::unique_ptr<PdbSymbolCache> open(const std::string &path, const PdbSignature &signature);
+    // written aside and renamed over path, false on io errors
+    bool save(const std::string &path) const;
+public:
+    inline const PdbSignature &signature() const noexcept { return _signature; }
+    inline size_t size() const noexcept { return _count; }
+    std::optional<uint32_t> find(std::string_view name) const noexcept;
+    // index < size(), in name order; the name views the cache
+    PdbSymbol symbol(size_t index) const noexcept;
+private:
+    PdbSymbolCache() = default;
+    // points the tables into data, false if malformed
+    bool attach(const uint8_t *data, size_t size);
+    inline std::string_view name(const PdbSymbolCacheEntry &entry) const noexcept { return std::string_view(_strings + entry.name, entry.name_length); }
+private:
+    std::unique_ptr<MappedFile> _file;
+    std::vector<uint8_t> _buffer;    // built in memory
+    const uint8_t *_data = nullptr;
+    size_t _size = 0;
+
+    PdbSignature _signature{};
+    const PdbSymbolCacheEntry *_entries = nullptr;
+    size_t _count = 0;
+    const char *_strings = nullptr;
+};
+
+}
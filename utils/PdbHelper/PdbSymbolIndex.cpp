@@ -0,0 +1,86 @@
+#include "PdbSymbolIndex.h"
+
+#include <stdio.h>
+#include <algorithm>
+
+#include "../../core/pe_structure/FunctionIndex.h"
+
+namespace pkn
+{
+
+PdbSymbolIndex PdbSymbolIndex::build(std::vector<PdbSymbol> symbols, const PEView *image)
+{
+    std::stable_sort(symbols.begin(), symbols.end(), [](const PdbSymbol &lhs, const PdbSymbol &rhs)
+                     {
+                         return lhs.rva < rhs.rva;
+                     });
+    symbols.erase(std::unique(symbols.begin(), symbols.end(), [](const PdbSymbol &lhs, const PdbSymbol &rhs)
+                              {
+                                  return lhs.rva == rhs.rva;
+                              }),
+                  symbols.end());
+
+    PdbSymbolIndex index;
+    size_t n = symbols.size();
+    index._begins.resize(n);
+    index._ends.resize(n);
+    index._names.resize(n);
+    index._name_lengths.resize(n);
+    size_t string_size = 0;
+    for (auto &symbol : symbols)
+        string_size += symbol.name.size();
+    index._strings.reserve(string_size);
+    for (size_t i = 0; i < n; i++)
+    {
+        auto &symbol = symbols[i];
+        index._begins[i] = symbol.rva;
+        index._ends[i] = i + 1 < n ? symbols[i + 1].rva : UINT32_MAX;
+        index._names[i] = (uint32_t)index._strings.size();
+        index._name_lengths[i] = (uint32_t)symbol.name.size();
+        index._strings.insert(index._strings.end(), symbol.name.begin(), symbol.name.end());
+    }
+    if (image == nullptr)
+        return index;
+
+    // no symbol spans past its section, sections are sorted by address in valid images
+    std::vector<std::pair<uint32_t, uint32_t>> sections;
+    for (size_t i = 0; i < image->section_count(); i++)
+    {
+        auto section = image->section(i);
+        uint64_t end = (uint64_t)section.VirtualAddress + (section.VirtualSize != 0 ? section.VirtualSize : section.SizeOfRawData);
+        sections.emplace_back(section.VirtualAddress, (uint32_t)std::min<uint64_t>(end, UINT32_MAX));
+    }
+    std::sort(sections.begin(), sections.end());
+    auto functions = FunctionIndex::build(*image);
+    for (size_t i = 0; i < n; i++)
+    {
+        uint32_t begin = index._begins[i];
+        auto section = std::upper_bound(sections.begin(), sections.end(), std::make_pair(begin, UINT32_MAX));
+        if (section != sections.begin() && begin < (section - 1)->second)
+            index._ends[i] = std::min(index._ends[i], (section - 1)->second);
+        if (symbols[i].code)
+        {
+            auto function = functions.find(begin);
+            if (function && function->begin == begin)
+                index._ends[i] = std::min(index._ends[i], function->end);
+        }
+    }
+    return index;
+}
+
+std::string PdbSymbolIndex::format(uint32_t rva) const
+{
+    auto location = find(rva);
+    if (!location)
+        return {};
+    std::string result(location->name);
+    if (location->offset != 0)
+    {
+        char offset[16];
+        snprintf(offset, sizeof(offset), "+0x%x", location->offset);
+        result += offset;
+    }
+    return result;
+}
+
+}
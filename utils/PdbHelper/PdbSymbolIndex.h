@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../core/base/algorithm/branchless_search.hpp"
+#include "../../core/pe_structure/PEView.h"
+#include "PdbFile.h"
+
+namespace pkn
+{
+
+struct SymbolLocation
+{
+    std::string_view name;   // views the index
+    uint32_t rva;            // of the symbol
+    uint32_t offset;         // of the address from the symbol
+};
+
+/*
+Rva to symbol of one image, the reverse of a pdb name lookup.
+Symbols are kept sorted by rva in separate begin and end arrays: a symbol ends where the next one
+starts, at the end of its section, or at the end of its .pdata entry for x64 functions when the
+image is given, so addresses in padding or outside any section find nothing.
+Lookups are branch free binary searches over the begins, batch lookups interleave their searches
+like FunctionIndex does.
+
+usage:
+@code
+auto index = PdbSymbolIndex::build(pdb->symbols(), &*pe);
+printf("%s\n", index.format(rva).c_str()); // "KiSystemCall64+0x1c"
+@endcode
+*/
+class PdbSymbolIndex
+{
+public:
+    constexpr static size_t NotFound = RangeNotFound;
+public:
+    // one symbol is kept per rva, the first given; image bounds the symbols by its sections and functions
+    static PdbSymbolIndex build(std::vector<PdbSymbol> symbols, const PEView *image = nullptr);
+public:
+    inline size_t size() const noexcept { return _begins.size(); }
+    inline bool empty() const noexcept { return _begins.empty(); }
+    inline uint32_t rva(size_t index) const noexcept { return _begins[index]; }
+    inline uint32_t end(size_t index) const noexcept { return _ends[index]; }
+    inline std::string_view name(size_t index) const noexcept { return std::string_view(_strings.data() + _names[index], _name_lengths[index]); }
+    // sorted rva of every symbol, size() entries
+    inline const uint32_t *begins() const noexcept { return _begins.data(); }
+
+    // index of the symbol containing rva, NotFound if none
+    inline size_t index_of(uint32_t rva) const noexcept
+    {
+        return branchless_upper_search(_begins.data(), _ends.data(), _begins.size(), rva);
+    }
+    // indexes[i] = index_of(rvas[i]), the searches run interleaved
+    inline void index_of(const uint32_t *rvas, size_t count, size_t *indexes) const noexcept
+    {
+        branchless_upper_search(_begins.data(), _ends.data(), _begins.size(), rvas, count, indexes);
+    }
+
+    inline std::optional<SymbolLocation> find(uint32_t rva) const noexcept
+    {
+        size_t index = index_of(rva);
+        if (index == NotFound)
+            return std::nullopt;
+        return SymbolLocation{ name(index), _begins[index], rva - _begins[index] };
+    }
+    // "name+0x1c", "name" at the symbol itself, empty if no symbol contains rva
+    std::string format(uint32_t rva) const;
+private:
+    std::vector<uint32_t> _begins;
+    std::vector<uint32_t> _ends;
+    std::vector<uint32_t> _names;         // offsets in _strings
+    std::vector<uint32_t> _name_lengths;
+    std::vector<char> _strings;
+};
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <pkn/core/reader/TypedReader.hpp>
+#include <pkn/core/reader/ReadInstrumentation.h>
 #include "pkn/core/injector/injector.hpp"
 
 #include "Types/EngineClass.h"
@@ -9,6 +10,20 @@
 
 namespace UE4
 {
+// only the fields LocalClass::parse looks at
+using ClassParseProjection = pkn::FieldProjection<UClass, pkn::ProjectionDefaultGap,
+    PKN_FIELD(UClass, Name),
+    PKN_FIELD(UClass, SuperStruct),
+    PKN_FIELD(UClass, Children)>;
+using ClassNameProjection = pkn::FieldProjection<UClass, pkn::ProjectionDefaultGap,
+    PKN_FIELD(UClass, Name)>;
+using PropertyParseProjection = pkn::FieldProjection<UProperty, pkn::ProjectionDefaultGap,
+    PKN_FIELD(UProperty, Class),
+    PKN_FIELD(UProperty, Name),
+    PKN_FIELD(UProperty, Next),
+    PKN_FIELD(UProperty, ElementSize),
+    PKN_FIELD(UProperty, Offset_Internal)>;
+
 struct LocalPropertyInfo
 {
 public:
@@ -58,7 +73,7 @@ public:
     {
         auto &unreal_reader = pkn::SingletonInjector<UnrealReader>::get();
         auto &name_cache = pkn::SingletonInjector<UnrealNameCache>::get();
-        if (auto res = unreal_reader.read<UClass>(remote_address))
+        if (auto res = unreal_reader.read_projected<ClassParseProjection>(remote_address))
         {
             const UClass &c = *res;
             return parse(c, with_parents);
@@ -68,6 +83,7 @@ public:
 
     static std::optional<LocalClass> parse(const UClass &c, bool with_parents = true)
     {
+        PKN_READ_TAG("LocalClass::parse");
         auto &unreal_reader = pkn::SingletonInjector<UnrealReader>::get();
         auto &name_cache = pkn::SingletonInjector<UnrealNameCache>::get();
         if (auto res = name_cache.name_for_object(c))
@@ -84,13 +100,13 @@ public:
             UField *children = c.Children;
             while (children != nullptr)
             {
-                if (auto res = unreal_reader.read<UProperty>(children))
+                if (auto res = unreal_reader.read_projected<PropertyParseProjection>((rptr_t)children))
                 {
                     const auto &prop = *res;
                     LocalPropertyInfo lpi;
                     if (prop.Class)
                     {
-                        if (auto res = unreal_reader.read<UClass>(prop.Class))
+                        if (auto res = unreal_reader.read_projected<ClassNameProjection>((rptr_t)prop.Class))
                         {
                             const auto &pc = *res;
                             if (auto pcn = name_cache.name_for_object(pc))
@@ -6,6 +6,7 @@
 
 #include <pkn/core/base/types.h>
 #include <pkn/core/reader/TypedReader.hpp>
+#include <pkn/core/reader/ReadInstrumentation.h>
 #include <pkn/core/injector/injector.hpp>
 #include "pkn/core/marcos/debug_print.h"
 
@@ -21,6 +22,11 @@ class UnrealNameCache
 public:
     constexpr static const int NAME_WIDE_MASK = 0x01;
     constexpr static const int NAME_INDEX_SHIFT = 1;
+    // most names are short, read this much of the inline name buffer first and the rest only if needed
+    constexpr static const size_t NAME_PREFIX_BYTES = 128;
+    using NameEntryProjection = pkn::FieldProjection<FNameEntry, pkn::ProjectionDefaultGap,
+        PKN_FIELD(FNameEntry, Index),
+        PKN_FIELD_PREFIX(FNameEntry, AnsiName, NAME_PREFIX_BYTES)>;
 public:
     UnrealNameCache(erptr_t ppnames)
         : ppnames(ppnames)
@@ -31,6 +37,7 @@ public:
     }
     inline bool make_name_cache()
     {
+        PKN_READ_TAG("UnrealNameCache::make_name_cache");
         auto &kp = pkn::SingletonInjector<pkn::KernelProcess>::get();
         erptr_t pnames;
         if (!tr.read_into(ppnames, &pnames))
@@ -55,7 +62,7 @@ public:
                         {
                             uint32_t index = uint32_t(i * index_number_for_one_chunk + j);
                             FNameEntry name;
-                            if (tr.read_into((rptr_t)pname_entry, &name))
+                            if (read_name_entry((rptr_t)pname_entry, &name))
                             {
                                 _max_index = std::max(_max_index, index);
                                 if (name.Index & NAME_WIDE_MASK)
@@ -77,6 +84,19 @@ public:
         _cached = true;
         return true;
     }
+    inline bool read_name_entry(erptr_t remote_address, FNameEntry *name) const noexcept
+    {
+        if (!tr.read_projected<NameEntryProjection>(remote_address, name))
+            return false;
+        bool terminated = false;
+        if (name->Index & NAME_WIDE_MASK)
+            terminated = std::char_traits<wchar_t>::find(name->WideName, NAME_PREFIX_BYTES / sizeof(wchar_t), L'\0') != nullptr;
+        else
+            terminated = std::char_traits<char>::find(name->AnsiName, NAME_PREFIX_BYTES, '\0') != nullptr;
+        if (terminated)
+            return true;
+        return tr.read_into(remote_address, name);
+    }
     inline bool make_reverse_cache()
     {
         if (!_cached)
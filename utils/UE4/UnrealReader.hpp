@@ -3,6 +3,7 @@
 #include <optional>
 
 #include <pkn/core/reader/TypedReader.hpp>
+#include <pkn/core/reader/RemoteContainers.hpp>
 #include <pkn/core/injector/injector.hpp>
 #include "pkn/core/marcos/debug_print.h"
 
@@ -72,6 +73,33 @@ public:
         return std::nullopt;
     }
 
+    // read only the fields listed in Projection, see pkn/core/reader/FieldProjection.hpp
+    template <class Projection>
+    std::optional<typename Projection::type> read_projected(erptr_t ptr) const noexcept
+    {
+        using T = typename Projection::type;
+        std::aligned_storage_t<sizeof(T)> buffer[1];
+        if (tr.template read_projected<Projection>(ptr, (T *)buffer))
+        {
+            return *(T *)buffer;
+        }
+        return std::nullopt;
+    }
+
+    // chunked view over the elements of a remote TArray
+    template <class T>
+    pkn::RemoteArray<T> array(const TArray<T> &a, size_t chunk_size = pkn::RemoteContainerDefaultChunk) const
+    {
+        return pkn::RemoteArray<T>(tr.reader(), (rptr_t)a.Data, a.Count > 0 ? (size_t)a.Count : 0, chunk_size);
+    }
+
+    // chunked view over the objects pointed by a remote TArray of pointers, pointees are read in batches
+    template <class T>
+    pkn::RemotePointerArray<T> pointer_array(const TArray<T *> &a, size_t chunk_size = pkn::RemoteContainerDefaultChunk) const
+    {
+        return pkn::RemotePointerArray<T>(tr.reader(), (rptr_t)a.Data, a.Count > 0 ? (size_t)a.Count : 0, chunk_size);
+    }
+
 public:
     pkn::TypedReader &tr = pkn::SingletonInjector<pkn::TypedReader>::get();
 };